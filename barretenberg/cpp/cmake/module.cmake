@@ -23,6 +23,14 @@ target_sources(
     BASE_DIRS ${CMAKE_CURRENT_SOURCE_DIR}/src
 )
 
+# Tests write the pippenger point table cache (see srs/point_table_cache.hpp) to a temporary directory rather than next
+# to the SRS they are run against
+if(DEFINED ENV{TMPDIR})
+    set(BB_TEST_POINT_TABLE_CACHE_DIR "$ENV{TMPDIR}/bb_point_table_cache")
+else()
+    set(BB_TEST_POINT_TABLE_CACHE_DIR "/tmp/bb_point_table_cache")
+endif()
+
 function(barretenberg_module MODULE_NAME)
     file(GLOB_RECURSE SOURCE_FILES *.cpp)
     file(GLOB_RECURSE HEADER_FILES *.hpp *.tcc)
@@ -168,7 +176,9 @@ function(barretenberg_module MODULE_NAME)
                 WORKING_DIRECTORY ${CMAKE_BINARY_DIR})
             else()
                 # Currently haven't found a way to easily wrap the calls in wasmtime when run from ctest.
-                gtest_discover_tests(${MODULE_NAME}_tests WORKING_DIRECTORY ${CMAKE_BINARY_DIR} TEST_FILTER -*_SKIP_CI*)
+                gtest_discover_tests(${MODULE_NAME}_tests
+                PROPERTIES ENVIRONMENT "BB_POINT_TABLE_CACHE_DIR=${BB_TEST_POINT_TABLE_CACHE_DIR}"
+                WORKING_DIRECTORY ${CMAKE_BINARY_DIR} TEST_FILTER -*_SKIP_CI*)
             endif()
         endif()
 
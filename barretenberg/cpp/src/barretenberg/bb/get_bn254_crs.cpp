@@ -1,5 +1,6 @@
 #include "get_bn254_crs.hpp"
 #include "barretenberg/bb/file_io.hpp"
+#include "barretenberg/srs/global_crs.hpp"
 
 namespace {
 std::vector<uint8_t> download_bn254_g1_data(size_t num_points)
@@ -74,4 +75,22 @@ g2::affine_element get_bn254_g2_data(const std::filesystem::path& path)
     write_file(g2_path, data);
     return from_buffer<g2::affine_element>(data.data());
 }
+
+/**
+ * @brief Initialize the global crs_factory for bn254 based on a known dyadic circuit size
+ * @details The pippenger point table of the prover CRS is cached next to the CRS files, so that later processes map
+ * it rather than recompute it.
+ *
+ * @param path the directory of the CRS files
+ * @param dyadic_circuit_size power-of-2 circuit size
+ */
+void init_bn254_crs(const std::filesystem::path& path, size_t dyadic_circuit_size)
+{
+    // TODO(https://github.com/AztecProtocol/barretenberg/issues/1097): tighter bound needed
+    // currently using 1.6x points in CRS because of structured polys, see notes for how to minimize
+    // Must +1 for Plonk only!
+    auto bn254_g1_data = get_bn254_g1_data(path, dyadic_circuit_size + dyadic_circuit_size * 6 / 10 + 1);
+    auto bn254_g2_data = get_bn254_g2_data(path);
+    srs::init_crs_factory(bn254_g1_data, bn254_g2_data, path.string());
+}
 } // namespace bb
\ No newline at end of file
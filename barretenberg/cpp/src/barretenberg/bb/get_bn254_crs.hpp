@@ -11,4 +11,5 @@
 namespace bb {
 std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& path, size_t num_points);
 g2::affine_element get_bn254_g2_data(const std::filesystem::path& path);
+void init_bn254_crs(const std::filesystem::path& path, size_t dyadic_circuit_size);
 } // namespace bb
\ No newline at end of file
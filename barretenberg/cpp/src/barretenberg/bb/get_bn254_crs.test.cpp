@@ -0,0 +1,80 @@
+#include "get_bn254_crs.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include "barretenberg/srs/point_table_cache.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <optional>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace bb;
+
+namespace {
+using Curve = curve::BN254;
+using AffineElement = Curve::AffineElement;
+
+const std::string SRS_PATH = "../srs_db/ignition";
+
+ino_t get_inode(std::string const& path)
+{
+    struct stat st;
+    return stat(path.c_str(), &st) == 0 ? st.st_ino : 0;
+}
+} // namespace
+
+/**
+ * @brief The prover CRS of bb maps the pippenger point table cache in the CRS directory once it has been written
+ */
+TEST(GetBn254Crs, InitCachesPointTable)
+{
+    // A CRS directory as bb downloads it, with enough points for the circuit sizes below
+    const size_t num_points = 2048;
+    const auto crs_dir = std::filesystem::temp_directory_path() / ("bb_crs_test_" + std::to_string(getpid()));
+    std::filesystem::create_directories(crs_dir);
+    std::vector<AffineElement> points(num_points);
+    srs::IO<Curve>::read_transcript_g1(points.data(), num_points, SRS_PATH);
+    g2::affine_element g2_x;
+    srs::IO<Curve>::read_transcript_g2(g2_x, SRS_PATH);
+    write_file(crs_dir / "bn254_g1.dat", to_buffer(points));
+    write_file(crs_dir / "bn254_g2.dat", to_buffer(g2_x));
+
+    // Cache next to the CRS, as bb does outside of ctest
+    const char* previous = std::getenv("BB_POINT_TABLE_CACHE_DIR");
+    const std::optional<std::string> previous_dir =
+        previous != nullptr ? std::optional<std::string>(previous) : std::nullopt;
+    unsetenv("BB_POINT_TABLE_CACHE_DIR");
+    const std::string cache_path = srs::PointTableCache<Curve>::get_cache_path(crs_dir.string());
+
+    auto expected = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    std::copy(points.begin(), points.end(), expected.get());
+    scalar_multiplication::generate_pippenger_point_table<Curve>(expected.get(), expected.get(), num_points);
+
+    // The first initialisation computes the table and writes the cache
+    const size_t circuit_size = 1024;
+    init_bn254_crs(crs_dir, circuit_size);
+    ASSERT_TRUE(std::filesystem::exists(cache_path));
+    const ino_t cache_inode = get_inode(cache_path);
+    auto crs = srs::get_bn254_crs_factory()->get_prover_crs(circuit_size);
+    for (size_t i = 0; i < 2 * circuit_size; ++i) {
+        EXPECT_EQ(crs->get_monomial_points()[i], expected.get()[i]);
+    }
+
+    // A later one, for a smaller circuit, maps the cache rather than writing it again
+    init_bn254_crs(crs_dir, circuit_size / 2);
+    EXPECT_EQ(get_inode(cache_path), cache_inode);
+    crs = srs::get_bn254_crs_factory()->get_prover_crs(circuit_size / 2);
+    for (size_t i = 0; i < circuit_size; ++i) {
+        EXPECT_EQ(crs->get_monomial_points()[i], expected.get()[i]);
+    }
+
+    std::filesystem::remove_all(crs_dir);
+    if (previous_dir.has_value()) {
+        setenv("BB_POINT_TABLE_CACHE_DIR", previous_dir->c_str(), 1);
+    }
+}
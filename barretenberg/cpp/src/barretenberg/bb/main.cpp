@@ -3,6 +3,7 @@
 #include "barretenberg/common/map.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/constants.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
 #include "barretenberg/dsl/acir_format/acir_format.hpp"
 #include "barretenberg/dsl/acir_format/proof_surgeon.hpp"
 #include "barretenberg/dsl/acir_proofs/honk_contract.hpp"
@@ -14,12 +15,17 @@
 #include "barretenberg/stdlib/client_ivc_verifier/client_ivc_recursive_verifier.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_keccak_flavor.hpp"
+#include "barretenberg/ultra_honk/decider_proving_key_cache.hpp"
 
 #include <cstddef>
 #ifndef DISABLE_AZTEC_VM
 #include "barretenberg/vm/avm/generated/flavor.hpp"
+#ifdef AVM_PROFILE_ALLOCATIONS
+#include "barretenberg/vm/avm/trace/allocation_counting.hpp"
+#endif
 #include "barretenberg/vm/avm/trace/common.hpp"
 #include "barretenberg/vm/avm/trace/execution.hpp"
+#include "barretenberg/vm/avm/trace/profile.hpp"
 #include "barretenberg/vm/aztec_constants.hpp"
 #include "barretenberg/vm/stats.hpp"
 #endif
@@ -29,6 +35,7 @@
 #include "get_grumpkin_crs.hpp"
 #include "libdeflate.h"
 #include "log.hpp"
+#include "server.hpp"
 #include <barretenberg/common/benchmark.hpp>
 #include <barretenberg/common/container.hpp>
 #include <barretenberg/common/log.hpp>
@@ -41,6 +48,7 @@
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <unistd.h>
 #include <vector>
 
 using namespace bb;
@@ -56,21 +64,6 @@ std::string CRS_PATH = getHomeDir() + "/.bb-crs";
 const std::filesystem::path current_path = std::filesystem::current_path();
 const auto current_dir = current_path.filename().string();
 
-/**
- * @brief Initialize the global crs_factory for bn254 based on a known dyadic circuit size
- *
- * @param dyadic_circuit_size power-of-2 circuit size
- */
-void init_bn254_crs(size_t dyadic_circuit_size)
-{
-    // TODO(https://github.com/AztecProtocol/barretenberg/issues/1097): tighter bound needed
-    // currently using 1.6x points in CRS because of structured polys, see notes for how to minimize
-    // Must +1 for Plonk only!
-    auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, dyadic_circuit_size + dyadic_circuit_size * 6 / 10 + 1);
-    auto bn254_g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory(bn254_g1_data, bn254_g2_data);
-}
-
 /**
  * @brief Initialize the global crs_factory for grumpkin based on a known dyadic circuit size
  * @details Grumpkin crs is required only for the ECCVM
@@ -160,7 +153,7 @@ bool proveAndVerify(const std::string& bytecodePath, const std::string& witnessP
 
     acir_proofs::AcirComposer acir_composer{ 0, verbose_logging };
     acir_composer.create_finalized_circuit(constraint_system, witness);
-    init_bn254_crs(acir_composer.get_finalized_dyadic_circuit_size());
+    init_bn254_crs(CRS_PATH, acir_composer.get_finalized_dyadic_circuit_size());
 
     Timer pk_timer;
     acir_composer.init_proving_key();
@@ -200,7 +193,7 @@ bool proveAndVerifyHonkAcirFormat(acir_format::AcirFormat constraint_system, aci
 
     // Construct Honk proof
     Prover prover{ builder };
-    init_bn254_crs(prover.proving_key->proving_key.circuit_size);
+    init_bn254_crs(CRS_PATH, prover.proving_key->proving_key.circuit_size);
     auto proof = prover.construct_proof();
 
     // Verify Honk proof
@@ -340,7 +333,7 @@ void client_ivc_prove_output_all_msgpack(const std::string& bytecodePath,
 
     using namespace acir_format;
 
-    init_bn254_crs(1 << 24);
+    init_bn254_crs(CRS_PATH, 1 << 24);
     init_grumpkin_crs(1 << 15);
 
     auto gzipped_bincodes = unpack_from_file<std::vector<std::string>>(bytecodePath);
@@ -427,7 +420,7 @@ bool verify_client_ivc(const std::filesystem::path& proof_path,
                        const std::filesystem::path& eccvm_vk_path,
                        const std::filesystem::path& translator_vk_path)
 {
-    init_bn254_crs(1);
+    init_bn254_crs(CRS_PATH, 1);
     init_grumpkin_crs(1 << 15);
 
     const auto proof = from_buffer<ClientIVC::Proof>(read_file(proof_path));
@@ -451,7 +444,7 @@ bool foldAndVerifyProgram(const std::string& bytecodePath, const std::string& wi
     using Flavor = MegaFlavor; // This is the only option
     using Builder = Flavor::CircuitBuilder;
 
-    init_bn254_crs(1 << 22);
+    init_bn254_crs(CRS_PATH, 1 << 22);
     init_grumpkin_crs(1 << 16);
 
     ClientIVC ivc;
@@ -500,7 +493,7 @@ void client_ivc_prove_output_all(const std::string& bytecodePath,
     using TranslatorVK = TranslatorFlavor::VerificationKey;
     using DeciderVK = ClientIVC::DeciderVerificationKey;
 
-    init_bn254_crs(1 << 22);
+    init_bn254_crs(CRS_PATH, 1 << 22);
     init_grumpkin_crs(1 << 16);
 
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/1101): remove use of auto_verify_mode
@@ -577,7 +570,7 @@ void prove_tube(const std::string& output_path)
     std::string eccVkPath = output_path + "/ecc_vk";
 
     // Note: this could be decreased once we optimise the size of the ClientIVC recursiveve rifier
-    init_bn254_crs(1 << 25);
+    init_bn254_crs(CRS_PATH, 1 << 25);
     init_grumpkin_crs(1 << 18);
 
     // Read the proof  and verification data from given files
@@ -667,7 +660,7 @@ void prove(const std::string& bytecodePath, const std::string& witnessPath, cons
 
     acir_proofs::AcirComposer acir_composer{ 0, verbose_logging };
     acir_composer.create_finalized_circuit(constraint_system, witness);
-    init_bn254_crs(acir_composer.get_finalized_dyadic_circuit_size());
+    init_bn254_crs(CRS_PATH, acir_composer.get_finalized_dyadic_circuit_size());
     acir_composer.init_proving_key();
     auto proof = acir_composer.create_proof();
 
@@ -779,7 +772,7 @@ void write_vk(const std::string& bytecodePath, const std::string& outputPath)
     acir_proofs::AcirComposer acir_composer{ 0, verbose_logging };
     acir_composer.create_finalized_circuit(constraint_system);
     acir_composer.finalize_circuit();
-    init_bn254_crs(acir_composer.get_finalized_dyadic_circuit_size());
+    init_bn254_crs(CRS_PATH, acir_composer.get_finalized_dyadic_circuit_size());
     acir_composer.init_proving_key();
     auto vk = acir_composer.init_verification_key();
     auto serialized_vk = to_buffer(*vk);
@@ -798,7 +791,7 @@ void write_pk(const std::string& bytecodePath, const std::string& outputPath)
     acir_proofs::AcirComposer acir_composer{ 0, verbose_logging };
     acir_composer.create_finalized_circuit(constraint_system);
     acir_composer.finalize_circuit();
-    init_bn254_crs(acir_composer.get_finalized_dyadic_circuit_size());
+    init_bn254_crs(CRS_PATH, acir_composer.get_finalized_dyadic_circuit_size());
     auto pk = acir_composer.init_proving_key();
     auto serialized_pk = to_buffer(*pk);
 
@@ -957,12 +950,15 @@ void vk_as_fields(const std::string& vk_path, const std::string& output_path)
  * @param public_inputs_path Path to the file containing the serialised avm public inputs
  * @param hints_path Path to the file containing the serialised avm circuit hints
  * @param output_path Path (directory) to write the output proof and verification keys
+ * @param profile_path Path to write a JSON profile of the trace generation to, by opcode and by gadget (could be
+ * empty, in which case no profile is taken)
  */
 void avm_prove(const std::filesystem::path& bytecode_path,
                const std::filesystem::path& calldata_path,
                const std::filesystem::path& public_inputs_path,
                const std::filesystem::path& hints_path,
-               const std::filesystem::path& output_path)
+               const std::filesystem::path& output_path,
+               const std::filesystem::path& profile_path = "")
 {
     std::vector<uint8_t> const bytecode = read_file(bytecode_path);
     std::vector<fr> const calldata = many_from_buffer<fr>(read_file(calldata_path));
@@ -980,12 +976,21 @@ void avm_prove(const std::filesystem::path& bytecode_path,
     vinfo("hints.contract_instance_hints size: ", avm_hints.contract_instance_hints.size());
 
     vinfo("initializing crs with size: ", avm_trace::Execution::SRS_SIZE);
-    init_bn254_crs(avm_trace::Execution::SRS_SIZE);
+    init_bn254_crs(CRS_PATH, avm_trace::Execution::SRS_SIZE);
+
+    auto& profile = avm_trace::TraceProfile::get();
+    profile.enable(!profile_path.empty());
 
     // Prove execution and return vk
     auto const [verification_key, proof] =
         AVM_TRACK_TIME_V("prove/all", avm_trace::Execution::prove(bytecode, calldata, public_inputs_vec, avm_hints));
 
+    if (!profile_path.empty()) {
+        std::string profile_json = profile.to_json();
+        write_file(profile_path, { profile_json.begin(), profile_json.end() });
+        vinfo("trace generation profile written to: ", profile_path);
+    }
+
     std::vector<fr> vk_as_fields = verification_key.to_field_elements();
 
     vinfo("vk fields size: ", vk_as_fields.size());
@@ -1013,26 +1018,11 @@ void avm_prove(const std::filesystem::path& bytecode_path,
 }
 
 /**
- * @brief Verifies an avm proof and writes the result to stdout
- *
- * Communication:
- * - proc_exit: A boolean value is returned indicating whether the proof is valid.
- *   an exit code of 0 will be returned for success and 1 for failure.
- *
- * @param proof_path Path to the file containing the serialized proof
- * @param vk_path Path to the file containing the serialized verification key
- * @return true If the proof is valid
- * @return false If the proof is invalid
+ * @brief Verifies an avm proof against a verification key given as field elements, using the global crs
  */
-bool avm_verify(const std::filesystem::path& proof_path, const std::filesystem::path& vk_path)
+bool avm_verify_proof(std::vector<fr> const& proof, std::vector<fr> const& vk_as_fields)
 {
     using Commitment = AvmFlavorSettings::Commitment;
-    std::vector<fr> const proof = many_from_buffer<fr>(read_file(proof_path));
-    std::vector<uint8_t> vk_bytes = read_file(vk_path);
-    std::vector<fr> vk_as_fields = many_from_buffer<fr>(vk_bytes);
-
-    vinfo("initializing crs with size: ", 1);
-    init_bn254_crs(1);
 
     auto circuit_size = uint64_t(vk_as_fields[0]);
     auto num_public_inputs = uint64_t(vk_as_fields[1]);
@@ -1063,6 +1053,30 @@ bool avm_verify(const std::filesystem::path& proof_path, const std::filesystem::
     vinfo("verified: ", verified);
     return verified;
 }
+
+/**
+ * @brief Verifies an avm proof and writes the result to stdout
+ *
+ * Communication:
+ * - proc_exit: A boolean value is returned indicating whether the proof is valid.
+ *   an exit code of 0 will be returned for success and 1 for failure.
+ *
+ * @param proof_path Path to the file containing the serialized proof
+ * @param vk_path Path to the file containing the serialized verification key
+ * @return true If the proof is valid
+ * @return false If the proof is invalid
+ */
+bool avm_verify(const std::filesystem::path& proof_path, const std::filesystem::path& vk_path)
+{
+    std::vector<fr> const proof = many_from_buffer<fr>(read_file(proof_path));
+    std::vector<uint8_t> vk_bytes = read_file(vk_path);
+    std::vector<fr> vk_as_fields = many_from_buffer<fr>(vk_bytes);
+
+    vinfo("initializing crs with size: ", 1);
+    init_bn254_crs(CRS_PATH, 1);
+
+    return avm_verify_proof(proof, vk_as_fields);
+}
 #endif
 
 /**
@@ -1091,7 +1105,7 @@ UltraProver_<Flavor> compute_valid_prover(const std::string& bytecodePath, const
 
     auto builder = acir_format::create_circuit<Builder>(constraint_system, 0, witness, honk_recursion);
     auto prover = Prover{ builder };
-    init_bn254_crs(prover.proving_key->proving_key.circuit_size);
+    init_bn254_crs(CRS_PATH, prover.proving_key->proving_key.circuit_size);
     return std::move(prover);
 }
 
@@ -1131,6 +1145,24 @@ void prove_honk(const std::string& bytecodePath, const std::string& witnessPath,
     }
 }
 
+/**
+ * @brief Verifies a serialized proof against a serialized verification key, using the global crs
+ */
+template <IsUltraFlavor Flavor>
+bool verify_honk_proof(const std::vector<uint8_t>& proof_buffer, const std::vector<uint8_t>& vk_buffer)
+{
+    using VerificationKey = Flavor::VerificationKey;
+    using Verifier = UltraVerifier_<Flavor>;
+    using VerifierCommitmentKey = bb::VerifierCommitmentKey<curve::BN254>;
+
+    auto proof = from_buffer<std::vector<bb::fr>>(proof_buffer);
+    auto vk = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(vk_buffer));
+    vk->pcs_verification_key = std::make_shared<VerifierCommitmentKey>();
+    Verifier verifier{ vk };
+
+    return verifier.verify_proof(proof);
+}
+
 /**
  * @brief Verifies a proof for an ACIR circuit
  *
@@ -1148,18 +1180,10 @@ void prove_honk(const std::string& bytecodePath, const std::string& witnessPath,
  */
 template <IsUltraFlavor Flavor> bool verify_honk(const std::string& proof_path, const std::string& vk_path)
 {
-    using VerificationKey = Flavor::VerificationKey;
-    using Verifier = UltraVerifier_<Flavor>;
-    using VerifierCommitmentKey = bb::VerifierCommitmentKey<curve::BN254>;
-
     auto g2_data = get_bn254_g2_data(CRS_PATH);
     srs::init_crs_factory({}, g2_data);
-    auto proof = from_buffer<std::vector<bb::fr>>(read_file(proof_path));
-    auto vk = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(read_file(vk_path)));
-    vk->pcs_verification_key = std::make_shared<VerifierCommitmentKey>();
-    Verifier verifier{ vk };
 
-    bool verified = verifier.verify_proof(proof);
+    bool verified = verify_honk_proof<Flavor>(read_file(proof_path), read_file(vk_path));
 
     vinfo("verified: ", verified);
     return verified;
@@ -1219,7 +1243,7 @@ void write_recursion_inputs_honk(const std::string& bytecodePath,
 
     // Construct Honk proof and verification key
     Prover prover{ builder };
-    init_bn254_crs(prover.proving_key->proving_key.circuit_size);
+    init_bn254_crs(CRS_PATH, prover.proving_key->proving_key.circuit_size);
     std::vector<FF> proof = prover.construct_proof();
     VerificationKey verification_key(prover.proving_key->proving_key);
 
@@ -1303,7 +1327,7 @@ void prove_output_all(const std::string& bytecodePath, const std::string& witnes
     acir_proofs::AcirComposer acir_composer{ 0, verbose_logging };
     acir_composer.create_finalized_circuit(constraint_system, witness);
     acir_composer.finalize_circuit();
-    init_bn254_crs(acir_composer.get_finalized_dyadic_circuit_size());
+    init_bn254_crs(CRS_PATH, acir_composer.get_finalized_dyadic_circuit_size());
     acir_composer.init_proving_key();
     auto proof = acir_composer.create_proof();
 
@@ -1369,7 +1393,7 @@ void prove_honk_output_all(const std::string& bytecodePath,
 
     // Construct Honk proof
     Prover prover{ builder };
-    init_bn254_crs(prover.proving_key->proving_key.circuit_size);
+    init_bn254_crs(CRS_PATH, prover.proving_key->proving_key.circuit_size);
     auto proof = prover.construct_proof();
 
     // We have been given a directory, we will write the proof and verification key
@@ -1403,6 +1427,185 @@ void prove_honk_output_all(const std::string& bytecodePath,
     vinfo("vk as fields written to: ", vkFieldsOutputPath);
 }
 
+/**
+ * @brief Initialize the global crs_factory for bn254, unless one large enough for dyadic_circuit_size already is
+ * @details The server only ever grows its crs, so that it is read once for the largest circuit it has proven.
+ */
+void ensure_bn254_crs(size_t dyadic_circuit_size)
+{
+    static size_t initialized_size = 0;
+    if (dyadic_circuit_size > initialized_size) {
+        init_bn254_crs(CRS_PATH, dyadic_circuit_size);
+        initialized_size = dyadic_circuit_size;
+    }
+}
+
+/**
+ * @brief Server job creating a Honk proof for an ACIR circuit, see prove_honk
+ */
+template <IsUltraFlavor Flavor> void serve_prove_honk(msgpack::object& obj, msgpack::sbuffer& buffer)
+{
+    using Builder = Flavor::CircuitBuilder;
+    using Prover = UltraProver_<Flavor>;
+    using VerificationKey = Flavor::VerificationKey;
+
+    messaging::TypedMessage<server::ProveRequest> request;
+    obj.convert(request);
+    auto& value = request.value;
+    server::ProveResponse response;
+    auto& timings = response.timings;
+
+    const bool honk_recursion = IsAnyOf<Flavor, UltraFlavor, UltraKeccakFlavor>;
+    auto constraint_system = server::time_phase(timings, "parse_circuit", [&] {
+        auto circuit_buffer = decompressedBuffer(value.bytecode.data(), value.bytecode.size());
+        return acir_format::circuit_buf_to_acir_format(circuit_buffer, honk_recursion);
+    });
+    auto witness = server::time_phase(timings, "parse_witness", [&] {
+        acir_format::WitnessVector witness;
+        if (!value.witness.empty()) {
+            witness = acir_format::witness_buf_to_witness_data(
+                decompressedBuffer(value.witness.data(), value.witness.size()));
+        }
+        return witness;
+    });
+    auto builder = server::time_phase(timings, "create_circuit", [&] {
+        return acir_format::create_circuit<Builder>(constraint_system, 0, witness, honk_recursion);
+    });
+    // The server is sent the same programs over and over, so the parts of their proving keys that do not depend on
+    // the witness are cached by program (Goblin flavors do not support this and construct their keys in full)
+    const auto program_hash = crypto::sha256(value.bytecode);
+    auto prover = server::time_phase(timings, "construct_proving_key", [&] {
+        if constexpr (IsGoblinFlavor<Flavor>) {
+            return Prover{ builder };
+        } else {
+            return Prover{ DeciderProvingKeyCache<Flavor>::get().construct_proving_key(program_hash, builder) };
+        }
+    });
+    server::time_phase(timings, "init_crs", [&] { ensure_bn254_crs(prover.proving_key->proving_key.circuit_size); });
+    auto proof = server::time_phase(timings, "construct_proof", [&] { return prover.construct_proof(); });
+    // Sliced up to sumcheck as in prove_honk
+    if constexpr (std::same_as<Flavor, UltraKeccakFlavor>) {
+        auto num_public_inputs = static_cast<uint32_t>(prover.proving_key->proving_key.num_public_inputs);
+        proof.erase(proof.begin() + num_public_inputs + 303, proof.end());
+    }
+    response.proof = to_buffer</*include_size=*/true>(proof);
+    if (value.with_vk) {
+        response.vk = server::time_phase(timings, "construct_vk", [&] {
+            if constexpr (IsGoblinFlavor<Flavor>) {
+                return to_buffer(VerificationKey(prover.proving_key->proving_key));
+            } else {
+                return to_buffer(
+                    *DeciderProvingKeyCache<Flavor>::get().get_verification_key(program_hash, *prover.proving_key));
+            }
+        });
+    }
+
+    messaging::MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<server::ProveResponse> response_message(request.msgType, header, response);
+    msgpack::pack(buffer, response_message);
+}
+
+/**
+ * @brief Server job verifying a Honk proof, see verify_honk
+ */
+template <IsUltraFlavor Flavor> void serve_verify_honk(msgpack::object& obj, msgpack::sbuffer& buffer)
+{
+    messaging::TypedMessage<server::VerifyRequest> request;
+    obj.convert(request);
+    server::VerifyResponse response;
+
+    // Verification only needs the G2 point, which any crs loaded by the server includes
+    server::time_phase(response.timings, "init_crs", [] { ensure_bn254_crs(1); });
+    response.verified = server::time_phase(response.timings, "verify", [&] {
+        return verify_honk_proof<Flavor>(request.value.proof, request.value.vk);
+    });
+
+    messaging::MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<server::VerifyResponse> response_message(request.msgType, header, response);
+    msgpack::pack(buffer, response_message);
+}
+
+#ifndef DISABLE_AZTEC_VM
+/**
+ * @brief Server job creating an avm proof, see avm_prove
+ */
+void serve_avm_prove(msgpack::object& obj, msgpack::sbuffer& buffer)
+{
+    messaging::TypedMessage<server::AvmProveRequest> request;
+    obj.convert(request);
+    server::ProveResponse response;
+    auto& timings = response.timings;
+
+    std::vector<fr> calldata;
+    std::vector<fr> public_inputs_vec;
+    avm_trace::ExecutionHints avm_hints;
+    server::time_phase(timings, "parse", [&] {
+        calldata = many_from_buffer<fr>(request.value.calldata);
+        public_inputs_vec = many_from_buffer<fr>(request.value.public_inputs);
+        avm_hints = avm_trace::ExecutionHints::from(request.value.hints);
+    });
+    server::time_phase(timings, "init_crs", [] { ensure_bn254_crs(avm_trace::Execution::SRS_SIZE); });
+    auto const [verification_key, proof] = server::time_phase(timings, "prove", [&] {
+        return avm_trace::Execution::prove(request.value.bytecode, calldata, public_inputs_vec, avm_hints);
+    });
+    response.proof = to_buffer(proof);
+    response.vk = to_buffer(verification_key.to_field_elements());
+
+    messaging::MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<server::ProveResponse> response_message(request.msgType, header, response);
+    msgpack::pack(buffer, response_message);
+}
+
+/**
+ * @brief Server job verifying an avm proof, see avm_verify
+ */
+void serve_avm_verify(msgpack::object& obj, msgpack::sbuffer& buffer)
+{
+    messaging::TypedMessage<server::VerifyRequest> request;
+    obj.convert(request);
+    server::VerifyResponse response;
+
+    server::time_phase(response.timings, "init_crs", [] { ensure_bn254_crs(1); });
+    response.verified = server::time_phase(response.timings, "verify", [&] {
+        return avm_verify_proof(many_from_buffer<fr>(request.value.proof), many_from_buffer<fr>(request.value.vk));
+    });
+
+    messaging::MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<server::VerifyResponse> response_message(request.msgType, header, response);
+    msgpack::pack(buffer, response_message);
+}
+#endif
+
+/**
+ * @brief Runs bb as a long-lived server accepting proving and verification jobs, see server.hpp
+ *
+ * Communication:
+ * - stdin/stdout: If no socket path is given, jobs are read from stdin and the responses written to stdout
+ * - Unix socket: Otherwise jobs are read from, and responses written to, connections to the socket
+ *
+ * @param socket_path Path of the Unix socket to listen on, or empty to use stdin and stdout
+ */
+void serve(const std::string& socket_path)
+{
+    server::Server bb_server;
+    bb_server.register_job(server::PROVE_ULTRA_HONK, serve_prove_honk<UltraFlavor>);
+    bb_server.register_job(server::PROVE_ULTRA_KECCAK_HONK, serve_prove_honk<UltraKeccakFlavor>);
+    bb_server.register_job(server::PROVE_MEGA_HONK, serve_prove_honk<MegaFlavor>);
+    bb_server.register_job(server::VERIFY_ULTRA_HONK, serve_verify_honk<UltraFlavor>);
+    bb_server.register_job(server::VERIFY_ULTRA_KECCAK_HONK, serve_verify_honk<UltraKeccakFlavor>);
+    bb_server.register_job(server::VERIFY_MEGA_HONK, serve_verify_honk<MegaFlavor>);
+#ifndef DISABLE_AZTEC_VM
+    bb_server.register_job(server::AVM_PROVE, serve_avm_prove);
+    bb_server.register_job(server::AVM_VERIFY, serve_avm_verify);
+#endif
+
+    if (socket_path.empty()) {
+        bb_server.serve(STDIN_FILENO, STDOUT_FILENO);
+    } else {
+        bb_server.listen(socket_path);
+    }
+}
+
 bool flag_present(std::vector<std::string>& args, const std::string& flag)
 {
     return std::find(args.begin(), args.end(), flag) != args.end();
@@ -1478,6 +1681,10 @@ int main(int argc, char* argv[])
         if (command == "fold_and_verify_program") {
             return foldAndVerifyProgram(bytecode_path, witness_path) ? 0 : 1;
         }
+        if (command == "server") {
+            serve(get_option(args, "--socket", ""));
+            return 0;
+        }
 
         if (command == "prove") {
             std::string output_path = get_option(args, "-o", "./proofs/proof");
@@ -1540,7 +1747,13 @@ int main(int argc, char* argv[])
             std::filesystem::path output_path = get_option(args, "-o", "./proofs");
             extern std::filesystem::path avm_dump_trace_path;
             avm_dump_trace_path = get_option(args, "--avm-dump-trace", "");
-            avm_prove(avm_bytecode_path, avm_calldata_path, avm_public_inputs_path, avm_hints_path, output_path);
+            std::filesystem::path avm_profile_path = get_option(args, "--avm-profile", "");
+            avm_prove(avm_bytecode_path,
+                      avm_calldata_path,
+                      avm_public_inputs_path,
+                      avm_hints_path,
+                      output_path,
+                      avm_profile_path);
         } else if (command == "avm_verify") {
             return avm_verify(proof_path, vk_path) ? 0 : 1;
 #endif
@@ -0,0 +1,155 @@
+#include "server.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/messaging/stream_parser.hpp"
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace bb::server {
+
+namespace {
+// Amount read from the input at a time
+constexpr size_t READ_SIZE = 1 << 20;
+} // namespace
+
+void FdOutputStream::write(const char* data, size_t size)
+{
+    while (size > 0) {
+        const ssize_t written = ::write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error(std::string("failed to write response: ") + std::strerror(errno));
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+}
+
+void Server::register_job(uint32_t msg_type, JobHandler handler)
+{
+    jobs.insert({ msg_type, std::move(handler) });
+}
+
+bool Server::serve(int input_fd, int output_fd)
+{
+    FdOutputStream output(output_fd);
+    StreamDispatcher<FdOutputStream> dispatcher(output);
+
+    const auto send_failure = [&](uint32_t msg_type, uint32_t message_id, const std::string& message) {
+        MsgHeader header(message_id);
+        TypedMessage<JobFailedResponse> response(JOB_FAILED, header, { msg_type, message });
+        output.send(response);
+    };
+
+    for (auto& entry : jobs) {
+        const uint32_t msg_type = entry.first;
+        JobHandler& job = entry.second;
+        std::function<bool(msgpack::object&)> handler = [&, msg_type](msgpack::object& obj) {
+            HeaderOnlyMessage request;
+            obj.convert(request);
+            msgpack::sbuffer buffer;
+            try {
+                Timer timer;
+                job(obj, buffer);
+                vinfo("job ", msg_type, " (", request.header.messageId, ") took ", timer.milliseconds(), "ms");
+            } catch (const std::exception& e) {
+                info("job ", msg_type, " (", request.header.messageId, ") failed: ", e.what());
+                send_failure(msg_type, request.header.messageId, e.what());
+                return true;
+            }
+            output.write(buffer.data(), buffer.size());
+            return true;
+        };
+        dispatcher.registerTarget(msg_type, handler);
+    }
+
+    msgpack::unpacker unpacker;
+    for (;;) {
+        unpacker.reserve_buffer(READ_SIZE);
+        const ssize_t num_read = ::read(input_fd, unpacker.buffer(), unpacker.buffer_capacity());
+        if (num_read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (num_read <= 0) {
+            return true;
+        }
+        unpacker.buffer_consumed(static_cast<size_t>(num_read));
+
+        msgpack::object_handle handle;
+        while (unpacker.next(handle)) {
+            msgpack::object obj = handle.get();
+            HeaderOnlyMessage request;
+            try {
+                obj.convert(request);
+            } catch (const std::exception& e) {
+                info("ignoring malformed message: ", e.what());
+                continue;
+            }
+            // Rather than leave the client waiting, reject jobs that the dispatcher would drop
+            if (request.msgType >= FIRST_APP_MSG_TYPE && !jobs.contains(request.msgType)) {
+                send_failure(request.msgType, request.header.messageId, "unknown job type");
+                continue;
+            }
+            if (!dispatcher.onNewData(obj)) {
+                return false;
+            }
+        }
+    }
+}
+
+void Server::listen(const std::string& socket_path)
+{
+    sockaddr_un address{};
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        throw std::runtime_error("socket path too long: " + socket_path);
+    }
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+    const int listen_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        throw std::runtime_error(std::string("failed to create socket: ") + std::strerror(errno));
+    }
+    // Replace the socket left behind by a previous server
+    ::unlink(socket_path.c_str());
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    if (::bind(listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listen_fd, SOMAXCONN) != 0) {
+        const std::string error = std::strerror(errno);
+        ::close(listen_fd);
+        throw std::runtime_error("failed to listen on " + socket_path + ": " + error);
+    }
+    info("bb server listening on ", socket_path);
+    // Writing to a connection that the client closed must fail the write rather than kill the server
+    std::signal(SIGPIPE, SIG_IGN);
+
+    bool running = true;
+    while (running) {
+        const int connection_fd = ::accept(listen_fd, nullptr, nullptr);
+        if (connection_fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            const std::string error = std::strerror(errno);
+            ::close(listen_fd);
+            throw std::runtime_error("failed to accept connection: " + error);
+        }
+        try {
+            running = serve(connection_fd, connection_fd);
+        } catch (const std::exception& e) {
+            // A client that went away mid-response is no reason to stop serving the others
+            info("connection dropped: ", e.what());
+        }
+        ::close(connection_fd);
+    }
+    ::close(listen_fd);
+    ::unlink(socket_path.c_str());
+}
+
+} // namespace bb::server
@@ -0,0 +1,152 @@
+#pragma once
+#include "barretenberg/common/timer.hpp"
+#include "barretenberg/messaging/header.hpp"
+#include "barretenberg/serialize/cbind.hpp"
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief A long-running bb process accepting proving and verification jobs
+ *
+ * @details Jobs are msgpack TypedMessages (see messaging/header.hpp) written back to back to the server's input,
+ * which is either stdin or a connection to a Unix socket. Each job is answered with a message of the same type whose
+ * header.requestId is the job's header.messageId, or with a JOB_FAILED message if the job threw. Jobs are run one at a
+ * time, in order, each of them using all of the cores. The system messages PING and TERMINATE are answered with a
+ * PONG and by shutting the server down respectively.
+ *
+ * Everything that a one-shot bb invocation sets up before it can start proving, the CRS, the plookup tables and the
+ * thread pools, is kept between jobs.
+ */
+namespace bb::server {
+
+using namespace bb::messaging;
+
+enum BbServerMessageType {
+    PROVE_ULTRA_HONK = FIRST_APP_MSG_TYPE,
+    PROVE_ULTRA_KECCAK_HONK,
+    PROVE_MEGA_HONK,
+
+    VERIFY_ULTRA_HONK,
+    VERIFY_ULTRA_KECCAK_HONK,
+    VERIFY_MEGA_HONK,
+
+    AVM_PROVE,
+    AVM_VERIFY,
+
+    JOB_FAILED = 999,
+};
+
+// Wall-clock time in microseconds spent in each phase of a job
+using PhaseTimings = std::map<std::string, uint64_t>;
+
+struct ProveRequest {
+    // The gzipped ACIR program and witness, as in the files taken by the bb prove commands. Nargo artifacts store the
+    // program base64 encoded in their bytecode field, which has to be decoded by the client.
+    std::vector<uint8_t> bytecode;
+    std::vector<uint8_t> witness;
+    // Also compute the verification key
+    bool with_vk;
+    MSGPACK_FIELDS(bytecode, witness, with_vk);
+};
+
+struct ProveResponse {
+    // The proof and verification key, serialized as in the files written by the bb prove and write_vk commands
+    std::vector<uint8_t> proof;
+    std::vector<uint8_t> vk;
+    PhaseTimings timings;
+    MSGPACK_FIELDS(proof, vk, timings);
+};
+
+struct VerifyRequest {
+    std::vector<uint8_t> proof;
+    std::vector<uint8_t> vk;
+    MSGPACK_FIELDS(proof, vk);
+};
+
+struct VerifyResponse {
+    bool verified;
+    PhaseTimings timings;
+    MSGPACK_FIELDS(verified, timings);
+};
+
+struct AvmProveRequest {
+    // The contents of the files taken by the avm_prove command
+    std::vector<uint8_t> bytecode;
+    std::vector<uint8_t> calldata;
+    std::vector<uint8_t> public_inputs;
+    std::vector<uint8_t> hints;
+    MSGPACK_FIELDS(bytecode, calldata, public_inputs, hints);
+};
+
+struct JobFailedResponse {
+    uint32_t msgType;
+    std::string message;
+    MSGPACK_FIELDS(msgType, message);
+};
+
+/**
+ * @brief Run f, recording its duration under the given phase name
+ */
+template <typename Func> auto time_phase(PhaseTimings& timings, const std::string& phase, Func&& f)
+{
+    Timer timer;
+    if constexpr (std::is_void_v<decltype(f())>) {
+        f();
+        timings[phase] = static_cast<uint64_t>(timer.nanoseconds() / 1000);
+    } else {
+        auto result = f();
+        timings[phase] = static_cast<uint64_t>(timer.nanoseconds() / 1000);
+        return result;
+    }
+}
+
+/**
+ * @brief Writes packed messages to a file descriptor
+ */
+class FdOutputStream {
+  public:
+    explicit FdOutputStream(int fd)
+        : fd(fd)
+    {}
+
+    template <typename T> void send(const T& message)
+    {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, message);
+        write(buffer.data(), buffer.size());
+    }
+
+    void write(const char* data, size_t size);
+
+  private:
+    int fd;
+};
+
+// Run the job in the request message and pack its response into the buffer
+using JobHandler = std::function<void(msgpack::object&, msgpack::sbuffer&)>;
+
+class Server {
+  public:
+    void register_job(uint32_t msg_type, JobHandler handler);
+
+    /**
+     * @brief Serve the jobs read from input_fd, writing the responses to output_fd, until the input is closed
+     * @return false if the server was asked to terminate
+     */
+    bool serve(int input_fd, int output_fd);
+
+    /**
+     * @brief Listen on a Unix socket, serving one connection at a time, until asked to terminate
+     */
+    void listen(const std::string& socket_path);
+
+  private:
+    std::unordered_map<uint32_t, JobHandler> jobs;
+};
+
+} // namespace bb::server
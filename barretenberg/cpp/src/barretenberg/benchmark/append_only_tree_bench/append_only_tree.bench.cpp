@@ -25,7 +25,6 @@ using Pedersen = ContentAddressedAppendOnlyTree<StoreType, PedersenHashPolicy>;
 using Poseidon2 = ContentAddressedAppendOnlyTree<StoreType, Poseidon2HashPolicy>;
 
 const size_t TREE_DEPTH = 32;
-const size_t MAX_BATCH_SIZE = 64;
 
 template <typename TreeType> void perform_batch_insert(TreeType& tree, const std::vector<fr>& values)
 {
@@ -52,7 +51,8 @@ template <typename TreeType> void append_only_tree_bench(State& state) noexcept
     std::string directory = random_temp_directory();
     std::string name = random_string();
     std::filesystem::create_directories(directory);
-    uint32_t num_threads = 16;
+    // Second argument: size of the worker pool, which also bounds the parallelism of the subtree hashing
+    const auto num_threads = uint32_t(state.range(1));
 
     LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(directory, name, 1024 * 1024, num_threads);
     std::unique_ptr<StoreType> store = std::make_unique<StoreType>(name, depth, db);
@@ -73,13 +73,17 @@ template <typename TreeType> void append_only_tree_bench(State& state) noexcept
 }
 BENCHMARK(append_only_tree_bench<Poseidon2>)
     ->Unit(benchmark::kMillisecond)
-    ->RangeMultiplier(2)
-    ->Range(2, MAX_BATCH_SIZE)
+    ->ArgsProduct({ { 2, 4, 8, 16, 32, 64 }, { 16 } })
     ->Iterations(1000);
 BENCHMARK(append_only_tree_bench<Poseidon2>)
     ->Unit(benchmark::kMillisecond)
-    ->RangeMultiplier(2)
-    ->Range(512, 8192)
+    ->ArgsProduct({ { 512, 1024, 2048, 4096, 8192 }, { 16 } })
+    ->Iterations(10);
+// Speedup of the parallel level hashing. With a single worker the levels are still split into two chunks, but the
+// worker doing the insertion hashes both: the helper job it enqueues can only start once every chunk is claimed.
+BENCHMARK(append_only_tree_bench<Poseidon2>)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgsProduct({ { 8192, 65536 }, { 1, 4, 16 } })
     ->Iterations(10);
 
 } // namespace
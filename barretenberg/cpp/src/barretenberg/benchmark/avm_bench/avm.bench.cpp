@@ -0,0 +1,141 @@
+#include "barretenberg/vm/avm/trace/allocation_counting.hpp"
+#include "barretenberg/vm/avm/trace/execution.hpp"
+#include "barretenberg/vm/avm/trace/instructions.hpp"
+#include "barretenberg/vm/avm/trace/opcode.hpp"
+#include "barretenberg/vm/avm/trace/profile.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+
+using namespace benchmark;
+using namespace bb::avm_trace;
+
+namespace {
+// Memory offsets of the loop state
+constexpr uint16_t COUNTER = 0;
+constexpr uint16_t ONE = 1;
+constexpr uint16_t LIMIT = 2;
+constexpr uint16_t CONDITION = 3;
+// Memory offset from which the programs keep their operands
+constexpr uint16_t OPERANDS = 16;
+
+Instruction set(AvmMemoryTag tag, uint32_t value, uint16_t dst)
+{
+    return Instruction(OpCode::SET_32, { uint8_t(0), tag, value, dst });
+}
+
+Instruction binary(OpCode opcode, uint16_t a, uint16_t b, uint16_t dst)
+{
+    return Instruction(opcode, { uint8_t(0), a, b, dst });
+}
+
+/**
+ * @brief A program running the body the given number of times. The setup is run once, before the loop.
+ */
+std::vector<Instruction> loop_program(uint32_t iterations,
+                                      const std::vector<Instruction>& setup,
+                                      const std::vector<Instruction>& body)
+{
+    std::vector<Instruction> program{
+        set(AvmMemoryTag::U32, 0, COUNTER),
+        set(AvmMemoryTag::U32, 1, ONE),
+        set(AvmMemoryTag::U32, iterations, LIMIT),
+    };
+    program.insert(program.end(), setup.begin(), setup.end());
+    const auto loop_start = static_cast<uint16_t>(program.size());
+    program.insert(program.end(), body.begin(), body.end());
+    program.push_back(binary(OpCode::ADD_16, COUNTER, ONE, COUNTER));
+    program.push_back(binary(OpCode::LT_16, COUNTER, LIMIT, CONDITION));
+    program.emplace_back(OpCode::JUMPI_16, std::vector<Operand>{ uint8_t(0), loop_start, CONDITION });
+    program.emplace_back(OpCode::RETURN, std::vector<Operand>{ uint8_t(0), uint16_t(0), uint16_t(0) });
+    return program;
+}
+
+// Sets size consecutive words of memory from OPERANDS onwards to distinct values of the given tag
+std::vector<Instruction> set_operands(AvmMemoryTag tag, uint16_t size)
+{
+    std::vector<Instruction> setup;
+    for (uint16_t i = 0; i < size; i++) {
+        setup.push_back(set(tag, i + 1U, static_cast<uint16_t>(OPERANDS + i)));
+    }
+    return setup;
+}
+
+std::vector<Instruction> arithmetic_program(uint32_t iterations)
+{
+    auto setup = set_operands(AvmMemoryTag::U64, 2);
+    return loop_program(iterations,
+                        setup,
+                        { binary(OpCode::ADD_16, OPERANDS, OPERANDS + 1, OPERANDS),
+                          binary(OpCode::MUL_16, OPERANDS, OPERANDS + 1, OPERANDS + 1),
+                          binary(OpCode::SUB_16, OPERANDS + 1, OPERANDS, OPERANDS) });
+}
+
+std::vector<Instruction> comparison_program(uint32_t iterations)
+{
+    auto setup = set_operands(AvmMemoryTag::U64, 2);
+    return loop_program(iterations,
+                        setup,
+                        { binary(OpCode::LT_16, OPERANDS, OPERANDS + 1, OPERANDS + 2),
+                          binary(OpCode::LTE_16, OPERANDS + 1, OPERANDS, OPERANDS + 3),
+                          binary(OpCode::EQ_16, OPERANDS, OPERANDS + 1, OPERANDS + 4) });
+}
+
+std::vector<Instruction> poseidon2_program(uint32_t iterations)
+{
+    // The permutation is done in place, on a state of 4 field elements
+    return loop_program(iterations,
+                        set_operands(AvmMemoryTag::FF, 4),
+                        { Instruction(OpCode::POSEIDON2, { uint8_t(0), OPERANDS, OPERANDS }) });
+}
+
+std::vector<Instruction> sha256_program(uint32_t iterations)
+{
+    // The compression is done in place on a state of 8 words, with 16 words of input after it
+    return loop_program(iterations,
+                        set_operands(AvmMemoryTag::U32, 24),
+                        { Instruction(OpCode::SHA256COMPRESSION,
+                                      { uint8_t(0), OPERANDS, OPERANDS, static_cast<uint16_t>(OPERANDS + 8) }) });
+}
+
+std::vector<Instruction> keccak_program(uint32_t iterations)
+{
+    // The permutation is done in place on a state of 25 words, with its size after it
+    auto setup = set_operands(AvmMemoryTag::U64, 25);
+    setup.push_back(set(AvmMemoryTag::U32, 25, OPERANDS + 25));
+    return loop_program(iterations,
+                        setup,
+                        { Instruction(OpCode::KECCAKF1600,
+                                      { uint8_t(0), OPERANDS, OPERANDS, static_cast<uint16_t>(OPERANDS + 25) }) });
+}
+
+/**
+ * @brief Generates the trace of the program built for the number of iterations given by the range, and reports the
+ * size of the trace and the allocations made per generation as counters
+ */
+template <std::vector<Instruction> (*Program)(uint32_t)> void gen_trace_bench(State& state) noexcept
+{
+    const auto instructions = Program(static_cast<uint32_t>(state.range(0)));
+    const auto public_inputs = Execution::getDefaultPublicInputs();
+    std::vector<FF> returndata;
+    size_t num_rows = 0;
+    const uint64_t start_allocations = get_num_allocations();
+    for (auto _ : state) {
+        returndata.clear();
+        auto trace = Execution::gen_trace(instructions, returndata, {}, public_inputs);
+        num_rows = trace.size();
+        DoNotOptimize(trace);
+    }
+    state.counters["rows"] = static_cast<double>(num_rows);
+    state.counters["allocations"] =
+        Counter(static_cast<double>(get_num_allocations() - start_allocations), Counter::kAvgIterations);
+}
+} // namespace
+
+BENCHMARK(gen_trace_bench<arithmetic_program>)->Arg(16)->Arg(256)->Arg(1024)->Unit(kMillisecond);
+BENCHMARK(gen_trace_bench<comparison_program>)->Arg(16)->Arg(256)->Arg(1024)->Unit(kMillisecond);
+BENCHMARK(gen_trace_bench<poseidon2_program>)->Arg(16)->Arg(256)->Arg(1024)->Unit(kMillisecond);
+BENCHMARK(gen_trace_bench<sha256_program>)->Arg(16)->Arg(256)->Arg(1024)->Unit(kMillisecond);
+BENCHMARK(gen_trace_bench<keccak_program>)->Arg(16)->Arg(256)->Arg(1024)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
@@ -30,6 +30,18 @@
 
 using namespace benchmark;
 using namespace bb;
+
+#ifndef NO_MULTITHREADING
+namespace bb {
+// The individual parallel_for back ends are not exposed in thread.hpp, since only one is selected at build time
+void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_queued(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_omp(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+} // namespace bb
+#endif
+
 namespace {
 using Curve = curve::BN254;
 using Fr = Curve::ScalarField;
@@ -68,6 +80,65 @@ void parallel_for_field_element_addition(State& state)
     }
 }
 
+#ifndef NO_MULTITHREADING
+using ParallelForBackend = void (*)(size_t, const std::function<void(size_t)>&);
+
+/**
+ * @brief Compare the parallel_for back ends on the same workload as parallel_for_field_element_addition
+ *
+ * @details The range is log2 of the number of parallel_for calls; the total amount of field work is fixed, so large
+ * ranges model many small fork-join rounds (e.g. the late rounds of sumcheck). Note that parallel_for_omp is
+ * sequential unless the library is built with OMP_MULTITHREADING.
+ */
+void parallel_for_backend(State& state, ParallelForBackend backend)
+{
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    size_t num_cpus = get_num_cpus();
+    std::vector<std::vector<Fr>> copy_vector(num_cpus);
+    for (size_t i = 0; i < num_cpus; i++) {
+        for (size_t j = 0; j < 2; j++) {
+            copy_vector[i].emplace_back(Fr::random_element(&engine));
+            copy_vector[i].emplace_back(Fr::random_element(&engine));
+        }
+    }
+    for (auto _ : state) {
+        state.PauseTiming();
+        size_t num_external_cycles = 1 << static_cast<size_t>(state.range(0));
+        size_t num_internal_cycles = 1 << (MAX_REPETITION_LOG - static_cast<size_t>(state.range(0)));
+        state.ResumeTiming();
+        for (size_t i = 0; i < num_external_cycles; i++) {
+            backend(num_cpus, [num_internal_cycles, &copy_vector](size_t index) {
+                for (size_t i = 0; i < num_internal_cycles; i++) {
+                    copy_vector[index][i & 1] += copy_vector[index][1 - (i & 1)];
+                }
+            });
+        }
+    }
+}
+
+/**
+ * @brief Nested parallel_for: an outer parallel_for_range whose chunks each issue their own parallel_for. Only the
+ * work-stealing back end supports this (mutex_pool aborts on nesting).
+ */
+void parallel_for_work_stealing_nested(State& state)
+{
+    size_t num_cpus = get_num_cpus();
+    size_t num_inner = 1 << static_cast<size_t>(state.range(0));
+    std::vector<Fr> accumulators(num_cpus * num_inner, Fr::one());
+    for (auto _ : state) {
+        parallel_for_work_stealing(num_cpus, [&](size_t outer) {
+            parallel_for_work_stealing(num_inner, [&](size_t inner) {
+                Fr& acc = accumulators[outer * num_inner + inner];
+                for (size_t i = 0; i < 64; i++) {
+                    acc *= acc + Fr::one();
+                }
+            });
+        });
+    }
+    benchmark::DoNotOptimize(accumulators);
+}
+#endif
+
 /**
  * @brief Evaluate how much finite addition costs (in cache)
  *
@@ -469,6 +540,22 @@ void pippenger(State& state)
 } // namespace
 
 BENCHMARK(parallel_for_field_element_addition)->Unit(kMicrosecond)->DenseRange(0, MAX_REPETITION_LOG);
+#ifndef NO_MULTITHREADING
+BENCHMARK_CAPTURE(parallel_for_backend, atomic_pool, &parallel_for_atomic_pool)
+    ->Unit(kMicrosecond)
+    ->DenseRange(0, MAX_REPETITION_LOG);
+BENCHMARK_CAPTURE(parallel_for_backend, mutex_pool, &parallel_for_mutex_pool)
+    ->Unit(kMicrosecond)
+    ->DenseRange(0, MAX_REPETITION_LOG);
+BENCHMARK_CAPTURE(parallel_for_backend, queued, &parallel_for_queued)
+    ->Unit(kMicrosecond)
+    ->DenseRange(0, MAX_REPETITION_LOG);
+BENCHMARK_CAPTURE(parallel_for_backend, omp, &parallel_for_omp)->Unit(kMicrosecond)->DenseRange(0, MAX_REPETITION_LOG);
+BENCHMARK_CAPTURE(parallel_for_backend, work_stealing, &parallel_for_work_stealing)
+    ->Unit(kMicrosecond)
+    ->DenseRange(0, MAX_REPETITION_LOG);
+BENCHMARK(parallel_for_work_stealing_nested)->Unit(kMicrosecond)->DenseRange(0, 10);
+#endif
 BENCHMARK(ff_addition)->Unit(kMicrosecond)->DenseRange(12, 30);
 BENCHMARK(ff_multiplication)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_sqr)->Unit(kMicrosecond)->DenseRange(12, 27);
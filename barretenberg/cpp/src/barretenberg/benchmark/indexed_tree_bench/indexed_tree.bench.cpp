@@ -11,6 +11,7 @@
 #include <benchmark/benchmark.h>
 #include <filesystem>
 #include <memory>
+#include <random>
 #include <vector>
 
 using namespace benchmark;
@@ -176,6 +177,61 @@ template <typename TreeType> void single_thread_indexed_tree_with_witness_bench(
     }
 }
 
+/**
+ * @brief Many threads writing to and reading from the uncommitted caches of one store, as the workers inserting into a
+ * tree do while requests read from it
+ */
+void concurrent_store_access_bench(State& state) noexcept
+{
+    static std::string directory;
+    static LMDBTreeStore::SharedPtr db;
+    static std::unique_ptr<StoreType> store;
+    if (state.thread_index() == 0) {
+        directory = random_temp_directory();
+        std::string name = random_string();
+        std::filesystem::create_directories(directory);
+        db = std::make_shared<LMDBTreeStore>(directory, name, 1024 * 1024, 64);
+        store = std::make_unique<StoreType>(name, TREE_DEPTH, db);
+    }
+
+    // The random engine is not thread safe, so each thread draws its values from its own generator
+    std::mt19937_64 rng(static_cast<uint64_t>(state.thread_index()));
+    const auto random_fr = [&]() { return fr(bb::numeric::uint256_t(rng(), rng(), rng(), rng())); };
+    const index_t base_index = static_cast<index_t>(state.thread_index()) << 32;
+    RequestContext context{ .includeUncommitted = true, .blockNumber = std::nullopt, .root = fr::zero() };
+    std::vector<fr> written;
+
+    // Each thread waits at the start of the loop until the store has been created
+    StoreType::ReadTransactionPtr tx;
+    for (auto _ : state) {
+        if (!tx) {
+            tx = store->create_read_transaction();
+        }
+        const fr key = random_fr();
+        const index_t index = base_index + written.size();
+        store->put_node_by_hash(key, NodePayload{ .left = key, .right = key, .ref = 1 });
+        store->put_cached_node_by_index(TREE_DEPTH, index, key);
+        store->update_index(index, key);
+        written.push_back(key);
+
+        NodePayload payload;
+        fr node;
+        for (size_t i = 0; i < 4; ++i) {
+            const size_t read = static_cast<size_t>(rng() % written.size());
+            DoNotOptimize(store->get_node_by_hash(written[read], payload, *tx, true));
+            DoNotOptimize(store->get_cached_node_by_index(TREE_DEPTH, base_index + read, node));
+        }
+        DoNotOptimize(store->find_low_value(random_fr(), context, *tx));
+    }
+    tx.reset();
+
+    if (state.thread_index() == 0) {
+        store.reset();
+        db.reset();
+        std::filesystem::remove_all(directory);
+    }
+}
+
 BENCHMARK(single_thread_indexed_tree_with_witness_bench<Poseidon2>)
     ->Unit(benchmark::kMillisecond)
     ->RangeMultiplier(2)
@@ -224,4 +280,6 @@ BENCHMARK(multi_thread_indexed_tree_bench<Poseidon2>)
     ->Range(512, 8192)
     ->Iterations(100);
 
+BENCHMARK(concurrent_store_access_bench)->Unit(benchmark::kMicrosecond)->ThreadRange(1, 16)->UseRealTime();
+
 BENCHMARK_MAIN();
@@ -1,5 +1,6 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
@@ -100,7 +101,64 @@ int coset_fft_regular()
     return 0;
 }
 
-int main()
+/**
+ * @brief Compare pippenger with the fixed-base MSM on the first 2^k SRS points, for k in [16, max_log_num_points]
+ * @details The fixed-base tables get the window width that is optimal for the MSM size, within the configured
+ * fixed-base MSM memory budget or 4GiB if there is none.
+ */
+int fixed_base_msm(size_t max_log_num_points)
+{
+    using FixedBaseMsm = scalar_multiplication::FixedBaseMsm<curve::BN254>;
+    const size_t memory_budget = scalar_multiplication::get_fixed_base_msm_memory_budget() != 0
+                                     ? scalar_multiplication::get_fixed_base_msm_memory_budget()
+                                     : size_t(4) << 30;
+    auto crs = std::make_shared<bb::srs::factories::FileProverCrs<curve::BN254>>(1UL << max_log_num_points,
+                                                                                "../srs_db/ignition");
+    for (size_t log_num_points = 16; log_num_points <= max_log_num_points; ++log_num_points) {
+        const size_t num_points = 1UL << log_num_points;
+        std::vector<fr> msm_scalars(num_points);
+        for (auto& scalar : msm_scalars) {
+            scalar = fr::random_element();
+        }
+        scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_points);
+
+        auto time_start = std::chrono::steady_clock::now();
+        g1::affine_element expected =
+            scalar_multiplication::pippenger_unsafe_optimized_for_non_dyadic_polys<curve::BN254>(
+                msm_scalars, crs->get_monomial_points(), state);
+        auto pippenger_time = std::chrono::steady_clock::now() - time_start;
+
+        const size_t bits_per_window = FixedBaseMsm::get_optimal_bits_per_window(num_points, memory_budget);
+        if (bits_per_window == 0) {
+            std::cout << "2^" << log_num_points << " points: fixed-base table does not fit in memory budget"
+                      << std::endl;
+            continue;
+        }
+        time_start = std::chrono::steady_clock::now();
+        FixedBaseMsm fixed_base(crs->get_monomial_points(), num_points, bits_per_window);
+        auto precompute_time = std::chrono::steady_clock::now() - time_start;
+
+        time_start = std::chrono::steady_clock::now();
+        g1::affine_element result = fixed_base.msm(msm_scalars);
+        auto fixed_base_time = std::chrono::steady_clock::now() - time_start;
+
+        using std::chrono::milliseconds;
+        std::cout << "2^" << log_num_points << " points: pippenger "
+                  << std::chrono::duration_cast<milliseconds>(pippenger_time).count() << "ms, fixed-base "
+                  << std::chrono::duration_cast<milliseconds>(fixed_base_time).count() << "ms (" << bits_per_window
+                  << "-bit windows, " << (FixedBaseMsm::get_table_size(num_points, bits_per_window) >> 20)
+                  << "MiB table precomputed in " << std::chrono::duration_cast<milliseconds>(precompute_time).count()
+                  << "ms)" << std::endl;
+        if (result != expected) {
+            std::cout << "fixed-base MSM result does not match pippenger!" << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Usage: pippenger_bench [max_log_num_points], where max_log_num_points bounds the fixed-base comparison (default 22)
+int main(int argc, char** argv)
 {
     bb::srs::init_crs_factory("../srs_db/ignition");
     std::cout << "initializing" << std::endl;
@@ -115,5 +173,7 @@ int main()
     pippenger();
     pippenger();
     pippenger();
-    return 0;
+    std::cout << "comparing pippenger with fixed-base MSM" << std::endl;
+    const size_t max_log_num_points = argc > 1 ? std::stoul(argv[1]) : 22;
+    return fixed_base_msm(max_log_num_points);
 }
@@ -0,0 +1,75 @@
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/polynomials/evaluation_domain.hpp"
+#include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+// The Plonk prover computes the quotient on a coset 4 times the size of the circuit, split into 4 polynomials
+constexpr size_t NUM_QUOTIENT_POLYS = 4;
+
+struct FFTInput {
+    evaluation_domain domain;
+    std::vector<std::vector<fr>> polys;
+    std::vector<fr*> poly_ptrs;
+
+    FFTInput(size_t log2_size, size_t num_polys)
+        : domain(1UL << log2_size)
+    {
+        domain.compute_lookup_table();
+        const size_t poly_size = domain.size / num_polys;
+        for (size_t i = 0; i < num_polys; ++i) {
+            std::vector<fr> poly(poly_size);
+            for (auto& coeff : poly) {
+                coeff = fr::random_element();
+            }
+            polys.emplace_back(std::move(poly));
+            poly_ptrs.push_back(polys.back().data());
+        }
+    }
+};
+
+/**
+ * @brief The cache-blocked radix-4 FFT, on a domain of 2^range(0) elements split into range(1) polynomials
+ */
+void fft_bench(State& state) noexcept
+{
+    FFTInput input(static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        polynomial_arithmetic::fft(input.poly_ptrs, input.domain);
+    }
+}
+
+/**
+ * @brief The radix-2 FFT it replaced, on the same inputs
+ */
+void fft_radix_2_bench(State& state) noexcept
+{
+    FFTInput input(static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        polynomial_arithmetic::fft_inner_parallel_radix_2(
+            input.poly_ptrs, input.domain, input.domain.root, input.domain.get_round_roots());
+    }
+}
+
+/**
+ * @brief A coset FFT followed by its inverse, as the Plonk prover does them on the quotient polynomials
+ */
+void coset_fft_ifft_bench(State& state) noexcept
+{
+    FFTInput input(static_cast<size_t>(state.range(0)), NUM_QUOTIENT_POLYS);
+    for (auto _ : state) {
+        polynomial_arithmetic::coset_fft(input.poly_ptrs, input.domain);
+        polynomial_arithmetic::coset_ifft(input.poly_ptrs, input.domain);
+    }
+}
+} // namespace
+
+BENCHMARK(fft_bench)->ArgsProduct({ DenseRange(14, 22, 2), { 1, NUM_QUOTIENT_POLYS } })->Unit(kMillisecond);
+BENCHMARK(fft_radix_2_bench)->ArgsProduct({ DenseRange(14, 22, 2), { 1, NUM_QUOTIENT_POLYS } })->Unit(kMillisecond);
+BENCHMARK(coset_fft_ifft_bench)->DenseRange(14, 22, 2)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
@@ -41,4 +41,43 @@ void poseiden_hash_bench(State& state) noexcept
 }
 BENCHMARK(poseiden_hash_bench)->Unit(benchmark::kMillisecond);
 
+using Poseidon2 = bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>;
+
+// How a level of pairs is hashed: one at a time through the sponge (with a vector per pair), one at a time through
+// hash_pair, or all together through hash_pairs
+enum class PairHasher { SPONGE, HASH_PAIR, HASH_PAIRS };
+
+/**
+ * @brief Hashes range(0) pairs, as a level of a Merkle tree. Reports the throughput of the single thread running it as
+ * hashes_per_second.
+ */
+template <PairHasher hasher> void poseidon2_hash_level_bench(State& state) noexcept
+{
+    const auto num_pairs = static_cast<size_t>(state.range(0));
+    std::vector<fr> children(num_pairs * 2);
+    for (auto& child : children) {
+        child = fr::random_element();
+    }
+    std::vector<fr> parents(num_pairs);
+    for (auto _ : state) {
+        if constexpr (hasher == PairHasher::SPONGE) {
+            for (size_t i = 0; i < num_pairs; ++i) {
+                parents[i] = Poseidon2::hash(std::vector<fr>({ children[i * 2], children[i * 2 + 1] }));
+            }
+        } else if constexpr (hasher == PairHasher::HASH_PAIR) {
+            for (size_t i = 0; i < num_pairs; ++i) {
+                parents[i] = Poseidon2::hash_pair(children[i * 2], children[i * 2 + 1]);
+            }
+        } else {
+            Poseidon2::hash_pairs(children, parents);
+        }
+        DoNotOptimize(parents.data());
+    }
+    state.counters["hashes_per_second"] =
+        Counter(static_cast<double>(num_pairs * state.iterations()), Counter::kIsRate);
+}
+BENCHMARK(poseidon2_hash_level_bench<PairHasher::SPONGE>)->Arg(1 << 10)->Arg(1 << 14)->Unit(kMillisecond);
+BENCHMARK(poseidon2_hash_level_bench<PairHasher::HASH_PAIR>)->Arg(1 << 10)->Arg(1 << 14)->Unit(kMillisecond);
+BENCHMARK(poseidon2_hash_level_bench<PairHasher::HASH_PAIRS>)->Arg(1 << 10)->Arg(1 << 14)->Unit(kMillisecond);
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include "barretenberg/crypto/merkle_tree/fixtures.hpp"
+#include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/world_state/types.hpp"
+#include "barretenberg/world_state/world_state.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+using namespace benchmark;
+using namespace bb::world_state;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+const uint64_t MAP_SIZE = 1024 * 1024;
+const uint64_t THREAD_POOL_SIZE = 16;
+const uint32_t INITIAL_HEADER_GENERATOR_POINT = 28;
+
+const std::unordered_map<MerkleTreeId, uint32_t> TREE_HEIGHTS{
+    { MerkleTreeId::NULLIFIER_TREE, 40 },   { MerkleTreeId::NOTE_HASH_TREE, 40 },
+    { MerkleTreeId::PUBLIC_DATA_TREE, 40 }, { MerkleTreeId::L1_TO_L2_MESSAGE_TREE, 39 },
+    { MerkleTreeId::ARCHIVE, 29 },
+};
+const std::unordered_map<MerkleTreeId, index_t> TREE_PREFILL{
+    { MerkleTreeId::NULLIFIER_TREE, 128 },
+    { MerkleTreeId::PUBLIC_DATA_TREE, 128 },
+};
+
+// A world state with a single synced block
+std::unique_ptr<WorldState> create_world_state(const std::string& directory)
+{
+    auto ws = std::make_unique<WorldState>(
+        THREAD_POOL_SIZE, directory, MAP_SIZE, TREE_HEIGHTS, TREE_PREFILL, INITIAL_HEADER_GENERATOR_POINT);
+    ws->sync_block(ws->get_state_reference(WorldStateRevision::committed()), fr(1), {}, {}, {}, {});
+    return ws;
+}
+} // namespace
+
+/**
+ * @brief Creates and deletes forks at the latest block, as a sequencer simulating transactions would
+ */
+void fork_churn_bench(State& state) noexcept
+{
+    std::string directory = random_temp_directory();
+    std::filesystem::create_directories(directory);
+    {
+        std::unique_ptr<WorldState> ws = create_world_state(directory);
+        for (auto _ : state) {
+            uint64_t fork_id = ws->create_fork(std::nullopt);
+            ws->delete_fork(fork_id);
+        }
+    }
+    std::filesystem::remove_all(directory);
+}
+
+/**
+ * @brief As fork_churn_bench, with a number of forks, given by the range, alive at any time. Each fork inserts a
+ * nullifier before being deleted, so that the cost of a fork that is written to is included.
+ */
+void fork_churn_with_writes_bench(State& state) noexcept
+{
+    const size_t num_live_forks = size_t(state.range(0));
+    std::string directory = random_temp_directory();
+    std::filesystem::create_directories(directory);
+    {
+        std::unique_ptr<WorldState> ws = create_world_state(directory);
+        std::vector<uint64_t> forks;
+        for (size_t i = 0; i < num_live_forks; ++i) {
+            forks.push_back(ws->create_fork(std::nullopt));
+        }
+        size_t next = 0;
+        for (auto _ : state) {
+            std::vector<NullifierLeafValue> nullifiers{ NullifierLeafValue(fr(random_engine.get_random_uint256())) };
+            uint64_t fork_id = ws->create_fork(std::nullopt);
+            ws->batch_insert_indexed_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, nullifiers, 0, fork_id);
+            ws->delete_fork(forks[next]);
+            forks[next] = fork_id;
+            next = (next + 1) % num_live_forks;
+        }
+    }
+    std::filesystem::remove_all(directory);
+}
+
+BENCHMARK(fork_churn_bench)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(fork_churn_with_writes_bench)->Unit(benchmark::kMicrosecond)->RangeMultiplier(4)->Range(1, 256);
+
+BENCHMARK_MAIN();
@@ -866,6 +866,92 @@ TEST(UltraCircuitConstructor, Ram)
     EXPECT_TRUE(CircuitChecker::check(duplicate_circuit_constructor));
 }
 
+namespace {
+/**
+ * @brief A circuit with range constraints and with ROM and RAM arrays accessed at the given (witness) indices, whose
+ * structure does not depend on the indices or on the values stored
+ */
+UltraCircuitBuilder build_circuit_with_memory(const std::array<uint32_t, 2>& indices, const size_t num_values = 8)
+{
+    UltraCircuitBuilder builder;
+    std::vector<uint32_t> values;
+    for (size_t i = 0; i < num_values; ++i) {
+        values.emplace_back(builder.add_variable(fr(engine.get_random_uint16() & 0x3fff)));
+        builder.create_range_constraint(values.back(), 14, "value out of range");
+    }
+
+    const size_t rom_id = builder.create_ROM_array(num_values);
+    const size_t ram_id = builder.create_RAM_array(num_values);
+    for (size_t i = 0; i < num_values; ++i) {
+        builder.set_ROM_element(rom_id, i, values[i]);
+        builder.init_RAM_element(ram_id, i, values[i]);
+    }
+    const uint32_t a_idx = builder.read_ROM_array(rom_id, builder.add_variable(indices[0]));
+    const uint32_t b_idx = builder.read_RAM_array(ram_id, builder.add_variable(indices[1]));
+    builder.write_RAM_array(ram_id, builder.add_variable(indices[0]), builder.add_variable(fr::random_element()));
+    const uint32_t c_idx = builder.read_RAM_array(ram_id, builder.add_variable(indices[0]));
+
+    const auto d_value = builder.get_variable(a_idx) + builder.get_variable(b_idx) + builder.get_variable(c_idx);
+    const uint32_t d_idx = builder.add_variable(d_value);
+    builder.create_big_add_gate({ a_idx, b_idx, c_idx, d_idx, 1, 1, 1, -1, 0 });
+    return builder;
+}
+} // namespace
+
+/**
+ * @brief A circuit finalized from the template of a circuit with the same structure but another witness is the same as
+ * if finalized in full
+ */
+TEST(UltraCircuitConstructor, FinalizeFromCircuitTemplate)
+{
+    auto recorded_circuit = build_circuit_with_memory({ 5, 2 });
+    recorded_circuit.record_circuit_template();
+    recorded_circuit.finalize_circuit(/*ensure_nonzero=*/true);
+    auto circuit_template = recorded_circuit.get_circuit_template();
+    ASSERT_NE(circuit_template, nullptr);
+
+    auto circuit = build_circuit_with_memory({ 1, 6 });
+    auto expected_circuit = circuit;
+    circuit.set_circuit_template(circuit_template);
+    EXPECT_TRUE(CircuitChecker::check(circuit));
+
+    circuit.finalize_circuit(/*ensure_nonzero=*/true);
+    expected_circuit.finalize_circuit(/*ensure_nonzero=*/true);
+    EXPECT_TRUE(circuit.is_finalized_from_template());
+    EXPECT_EQ(circuit.num_gates, expected_circuit.num_gates);
+    EXPECT_EQ(circuit.blocks, expected_circuit.blocks);
+    EXPECT_EQ(circuit.variables, expected_circuit.variables);
+    EXPECT_EQ(circuit.real_variable_index, expected_circuit.real_variable_index);
+    EXPECT_EQ(circuit.real_variable_tags, expected_circuit.real_variable_tags);
+
+    // The memory records of the sorted records are the same, but may be in another order
+    for (auto* records : { &circuit.memory_read_records,
+                           &circuit.memory_write_records,
+                           &expected_circuit.memory_read_records,
+                           &expected_circuit.memory_write_records }) {
+        std::sort(records->begin(), records->end());
+    }
+    EXPECT_EQ(circuit.memory_read_records, expected_circuit.memory_read_records);
+    EXPECT_EQ(circuit.memory_write_records, expected_circuit.memory_write_records);
+}
+
+/**
+ * @brief A circuit that does not match the structure of a template is finalized in full
+ */
+TEST(UltraCircuitConstructor, FinalizeFromMismatchedCircuitTemplate)
+{
+    auto recorded_circuit = build_circuit_with_memory({ 5, 2 });
+    recorded_circuit.record_circuit_template();
+    recorded_circuit.finalize_circuit(/*ensure_nonzero=*/true);
+
+    auto circuit = build_circuit_with_memory({ 5, 2 }, /*num_values=*/9);
+    circuit.set_circuit_template(recorded_circuit.get_circuit_template());
+    EXPECT_TRUE(CircuitChecker::check(circuit));
+
+    circuit.finalize_circuit(/*ensure_nonzero=*/true);
+    EXPECT_FALSE(circuit.is_finalized_from_template());
+}
+
 TEST(UltraCircuitConstructor, RangeChecksOnDuplicates)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
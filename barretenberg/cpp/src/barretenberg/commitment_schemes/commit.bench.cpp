@@ -247,6 +247,46 @@ template <typename Curve> void bench_commit_mock_z_perm_preprocessed(::benchmark
     }
 }
 
+// Number of polynomials committed to at once in the batch benchmarks, e.g. the wires of a wide trace
+constexpr size_t BATCH_NUM_POLYS = 256;
+
+// Commit to many sparse random polynomials one at a time with commit_sparse
+template <typename Curve> void bench_commit_sparse_random_many(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    std::vector<Polynomial<Fr>> polynomials;
+    for (size_t i = 0; i < BATCH_NUM_POLYS; ++i) {
+        polynomials.emplace_back(sparse_random_poly<Fr>(num_points, SPARSE_NUM_NONZERO * (i % 10 + 1)));
+    }
+
+    for (auto _ : state) {
+        for (auto& polynomial : polynomials) {
+            key->commit_sparse(polynomial);
+        }
+    }
+}
+
+// Commit to many sparse random polynomials together with batch_commit
+template <typename Curve> void bench_commit_sparse_random_batch(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    std::vector<Polynomial<Fr>> polynomials;
+    for (size_t i = 0; i < BATCH_NUM_POLYS; ++i) {
+        polynomials.emplace_back(sparse_random_poly<Fr>(num_points, SPARSE_NUM_NONZERO * (i % 10 + 1)));
+    }
+    std::vector<PolynomialSpan<const Fr>> spans(polynomials.begin(), polynomials.end());
+
+    for (auto _ : state) {
+        key->batch_commit(spans);
+    }
+}
+
 BENCHMARK(bench_commit_zero<curve::BN254>)
     ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
     ->Unit(benchmark::kMillisecond);
@@ -262,6 +302,12 @@ BENCHMARK(bench_commit_sparse_random<curve::BN254>)
 BENCHMARK(bench_commit_sparse_random_preprocessed<curve::BN254>)
     ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
     ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_sparse_random_many<curve::BN254>)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS, 2)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_sparse_random_batch<curve::BN254>)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS, 2)
+    ->Unit(benchmark::kMillisecond);
 BENCHMARK(bench_commit_random<curve::BN254>)
     ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
     ->Unit(benchmark::kMillisecond);
@@ -20,8 +20,11 @@
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <memory>
+#include <numeric>
 #include <string_view>
 
 namespace bb {
@@ -37,6 +40,7 @@ namespace bb {
 template <class Curve> class CommitmentKey {
 
     using Fr = typename Curve::ScalarField;
+    using Element = typename Curve::Element;
     using Commitment = typename Curve::AffineElement;
     using G1 = typename Curve::AffineElement;
     static constexpr size_t EXTRA_SRS_POINTS_FOR_ECCVM_IPA = 1;
@@ -52,6 +56,10 @@ template <class Curve> class CommitmentKey {
     }
 
   public:
+    // Polynomials with at most this many nonzero coefficients are committed to by batch_commit with a single threaded
+    // MSM, many of them at once, rather than one at a time with the multithreaded pippenger.
+    static constexpr size_t BATCH_COMMIT_SMALL_MSM_SIZE = 1 << 11;
+
     scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<srs::factories::CrsFactory<Curve>> crs_factory;
     std::shared_ptr<srs::factories::ProverCrs<Curve>> srs;
@@ -97,6 +105,13 @@ template <class Curve> class CommitmentKey {
                                   srs->get_monomial_size()));
         }
 
+        // Use the precomputed fixed-base tables of the SRS if they cover the polynomial
+        if (auto fixed_base_msm = srs->get_fixed_base_msm();
+            fixed_base_msm != nullptr && polynomial.end_index() <= fixed_base_msm->get_num_points() &&
+            fixed_base_msm->is_efficient_for(polynomial.size())) {
+            return fixed_base_msm->msm(polynomial.span, polynomial.start_index);
+        }
+
         // Extract the precomputed point table (contains raw SRS points at even indices and the corresponding
         // endomorphism point (\beta*x, -y) at odd indices). We offset by polynomial.start_index * 2 to align
         // with our polynomial span.
@@ -317,6 +332,170 @@ template <class Curve> class CommitmentKey {
 
         return result;
     }
+
+    /**
+     * @brief Commit to many polynomials at once
+     * @details Committing to the polynomials one by one pays a fork/join of the whole thread pool per MSM, and the
+     * multithreaded pippenger is inefficient for MSMs with few nonzero inputs, which wide traces tend to have plenty
+     * of. Instead, the number of nonzero coefficients of each polynomial is counted first. Polynomials at or below
+     * BATCH_COMMIT_SMALL_MSM_SIZE nonzero coefficients are packed onto the threads, largest first, and each is
+     * committed to with a single threaded bucket MSM; every thread reuses one set of scratch buffers for all of its
+     * MSMs. The remaining polynomials are large enough to saturate the pool by themselves and are committed to in turn
+     * with commit_sparse or commit, sharing the key's pippenger runtime state.
+     *
+     * @param polynomials
+     * @return The commitments, in the order of the input polynomials
+     */
+    std::vector<Commitment> batch_commit(std::span<const PolynomialSpan<const Fr>> polynomials)
+    {
+        PROFILE_THIS();
+        const size_t num_polys = polynomials.size();
+        std::vector<Commitment> commitments(num_polys);
+
+        std::vector<size_t> num_nonzero(num_polys, 0);
+        parallel_for(num_polys, [&](size_t poly_idx) {
+            const auto& polynomial = polynomials[poly_idx];
+            ASSERT(polynomial.end_index() <= srs->get_monomial_size());
+            for (const Fr& coeff : polynomial.span) {
+                if (!coeff.is_zero()) {
+                    num_nonzero[poly_idx]++;
+                }
+            }
+        });
+
+        std::vector<size_t> small_polys;
+        std::vector<size_t> large_polys;
+        for (size_t poly_idx = 0; poly_idx < num_polys; ++poly_idx) {
+            auto& group = num_nonzero[poly_idx] <= BATCH_COMMIT_SMALL_MSM_SIZE ? small_polys : large_polys;
+            group.emplace_back(poly_idx);
+        }
+
+        if (!small_polys.empty()) {
+            // Schedule the largest MSMs first so that the threads finish at roughly the same time
+            std::sort(small_polys.begin(), small_polys.end(), [&](size_t a, size_t b) {
+                return num_nonzero[a] > num_nonzero[b];
+            });
+            const size_t num_threads = std::min(small_polys.size(), get_num_cpus());
+            std::atomic<size_t> next_poly = 0;
+            parallel_for(num_threads, [&](size_t) {
+                std::vector<Fr> scalars;
+                std::vector<const G1*> points;
+                std::vector<Element> buckets;
+                for (size_t i = next_poly.fetch_add(1); i < small_polys.size(); i = next_poly.fetch_add(1)) {
+                    const size_t poly_idx = small_polys[i];
+                    commitments[poly_idx] = commit_serial(polynomials[poly_idx], scalars, points, buckets);
+                }
+            });
+        }
+
+        for (const size_t poly_idx : large_polys) {
+            const auto& polynomial = polynomials[poly_idx];
+            // Same sparseness criterion as commit_structured uses to decide against copying out the nonzero inputs
+            constexpr size_t NONZERO_THRESHOLD = 75;
+            if (num_nonzero[poly_idx] * 100 / polynomial.size() > NONZERO_THRESHOLD) {
+                commitments[poly_idx] = commit(polynomial);
+            } else {
+                commitments[poly_idx] = commit_sparse(polynomial);
+            }
+        }
+
+        return commitments;
+    }
+
+    /**
+     * @brief Commit to a polynomial on the calling thread alone
+     * @details Uses the single threaded MSM that batch_commit runs on polynomials with few nonzero coefficients, so
+     * that such a polynomial can be committed to from within a parallel_for, e.g. by the task that computed it. Dense
+     * polynomials belong with commit or batch_commit.
+     */
+    Commitment commit_serial(PolynomialSpan<const Fr> polynomial)
+    {
+        std::vector<Fr> scalars;
+        std::vector<const G1*> points;
+        std::vector<Element> buckets;
+        return commit_serial(polynomial, scalars, points, buckets);
+    }
+
+  private:
+    Commitment commit_serial(PolynomialSpan<const Fr> polynomial,
+                             std::vector<Fr>& scalars,
+                             std::vector<const G1*>& points,
+                             std::vector<Element>& buckets)
+    {
+        ASSERT(polynomial.end_index() <= srs->get_monomial_size());
+        std::span<G1> point_table = srs->get_monomial_points();
+        scalars.clear();
+        points.clear();
+        for (size_t idx = 0; idx < polynomial.size(); ++idx) {
+            const Fr& scalar = polynomial.span[idx];
+            if (!scalar.is_zero()) {
+                scalars.emplace_back(scalar.from_montgomery_form());
+                points.emplace_back(&point_table[2 * (polynomial.start_index + idx)]);
+            }
+        }
+        return serial_msm(scalars, points, buckets);
+    }
+
+    /**
+     * @brief Single threaded bucket method MSM ∑ᵢ sᵢ⋅Pᵢ
+     *
+     * @param scalars the scalars sᵢ, out of Montgomery form
+     * @param points the points Pᵢ
+     * @param buckets scratch space, reused between calls
+     */
+    static Element serial_msm(const std::vector<Fr>& scalars,
+                              const std::vector<const G1*>& points,
+                              std::vector<Element>& buckets)
+    {
+        Element result;
+        result.self_set_infinity();
+        const size_t num_points = scalars.size();
+        if (num_points == 0) {
+            return result;
+        }
+
+        const size_t log_num_points = numeric::get_msb(static_cast<uint64_t>(num_points));
+        const size_t bits_per_window = std::clamp(log_num_points, size_t(3), size_t(16)) - 2;
+        const size_t num_scalar_bits = static_cast<size_t>(uint256_t(Fr::modulus).get_msb()) + 1;
+        const size_t num_windows = (num_scalar_bits + bits_per_window - 1) / bits_per_window;
+        const uint64_t window_mask = (1ULL << bits_per_window) - 1;
+        buckets.resize(window_mask);
+
+        for (size_t window = num_windows; window-- > 0;) {
+            for (size_t i = 0; i < bits_per_window; ++i) {
+                result.self_dbl();
+            }
+            for (auto& bucket : buckets) {
+                bucket.self_set_infinity();
+            }
+
+            const size_t bit_offset = window * bits_per_window;
+            const size_t limb = bit_offset / 64;
+            const size_t shift = bit_offset % 64;
+            for (size_t i = 0; i < num_points; ++i) {
+                uint64_t slice = scalars[i].data[limb] >> shift;
+                if (shift + bits_per_window > 64 && limb + 1 < 4) {
+                    slice |= scalars[i].data[limb + 1] << (64 - shift);
+                }
+                slice &= window_mask;
+                if (slice != 0) {
+                    buckets[slice - 1] += *points[i];
+                }
+            }
+
+            // ∑ⱼ j⋅Bⱼ as a running sum of running sums
+            Element running_sum;
+            Element window_sum;
+            running_sum.self_set_infinity();
+            window_sum.self_set_infinity();
+            for (size_t j = buckets.size(); j-- > 0;) {
+                running_sum += buckets[j];
+                window_sum += running_sum;
+            }
+            result += window_sum;
+        }
+        return result;
+    }
 };
 
 } // namespace bb
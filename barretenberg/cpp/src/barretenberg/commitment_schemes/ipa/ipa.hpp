@@ -8,6 +8,7 @@
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include <algorithm>
 #include <cstddef>
 #include <numeric>
 #include <string>
@@ -87,6 +88,31 @@ template <typename Curve_> class IPA {
    using Polynomial = bb::Polynomial<Fr>;
    using VerifierAccumulator = bool;
 
+   /**
+    * @brief A native IPA opening claim reduced to the check \f$C_0 = a_0G_s+a_0b_0U\f$, before computing the
+    * linear-size MSM \f$G_s=\langle\vec{s},\vec{G}\rangle\f$ (see \link IPA::reduce_verify_internal
+    * reduce_verify_internal \endlink)
+    */
+   struct DeferredClaim {
+       size_t poly_length;
+       std::vector<Fr> round_challenges_inv; // determine the vector s
+       GroupElement C_zero;
+       Commitment aux_generator;
+       Fr a_zero;
+       Fr b_zero;
+   };
+
+   /**
+    * @brief Native IPA opening claims whose \f$G_s\f$ MSMs are deferred, to be checked together by \link
+    * IPA::discharge_accumulator discharge_accumulator \endlink
+    */
+   struct BatchAccumulator {
+       std::vector<DeferredClaim> claims;
+
+       [[nodiscard]] bool empty() const { return claims.empty(); }
+       [[nodiscard]] size_t size() const { return claims.size(); }
+   };
+
 // These allow access to internal functions so that we can never use a mock transcript unless it's fuzzing or testing of IPA specifically
 #ifdef IPA_TEST
    FRIEND_TEST(IPATest, ChallengesAreZero);
@@ -303,6 +329,44 @@ template <typename Curve_> class IPA {
                                                       const OpeningClaim<Curve>& opening_claim,
                                                       auto& transcript)
         requires(!Curve::is_stdlib_type)
+    {
+        // Steps 1-6 and 9.
+        const DeferredClaim claim = reduce_verify_to_deferred_claim(vk, opening_claim, transcript);
+        const size_t poly_length = claim.poly_length;
+
+        // Step 7.
+        // Construct vector s
+        std::vector<Fr> s_vec = compute_s_vec(claim.round_challenges_inv, poly_length, Fr::one());
+
+        std::span<const Commitment> srs_elements = vk->get_monomial_points();
+        if (poly_length * 2 > srs_elements.size()) {
+            throw_or_abort("potential bug: Not enough SRS points for IPA!");
+        }
+        // Copy the G_vector to local memory.
+        std::vector<Commitment> G_vec_local = get_G_vec(srs_elements, poly_length);
+
+        // Step 8.
+        // Compute G₀
+        Commitment G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
+            {&s_vec[0], /*size*/ poly_length}, {&G_vec_local[0], /*size*/ poly_length}, vk->pippenger_runtime_state);
+
+        // Step 10.
+        // Compute C_right
+        GroupElement right_hand_side = G_zero * claim.a_zero + claim.aux_generator * claim.a_zero * claim.b_zero;
+
+        // Step 11.
+        // Check if C_right == C₀
+        return (claim.C_zero.normalize() == right_hand_side.normalize());
+    }
+
+    /**
+     * @brief Run the steps of native verification that do not depend on \f$G_s\f$, i.e. steps 1-6 and 9 of \link
+     * IPA::reduce_verify_internal reduce_verify_internal \endlink
+     */
+    static DeferredClaim reduce_verify_to_deferred_claim(const std::shared_ptr<VK>& vk,
+                                                         const OpeningClaim<Curve>& opening_claim,
+                                                         auto& transcript)
+        requires(!Curve::is_stdlib_type)
     {
         // Step 1.
         // Receive polynomial_degree + 1 = d from the prover
@@ -365,57 +429,53 @@ template <typename Curve_> class IPA {
                                    opening_claim.opening_pair.challenge.pow(1 << i));
         }
 
-        // Step 7.
-        // Construct vector s
-        std::vector<Fr> s_vec(poly_length, Fr::one());
+        // Step 9.
+        // Receive a₀ from the prover
+        auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
 
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/857): This code is not efficient as its
-        // O(nlogn). This can be optimized to be linear by computing a tree of products. Its very readable, so we're
-        // leaving it unoptimized for now.
-        parallel_for_heuristic(
-            poly_length,
-            [&](size_t i) {
-                for (size_t j = (log_poly_degree - 1); j != static_cast<size_t>(-1); j--) {
-                    auto bit = (i >> j) & 1;
-                    bool b = static_cast<bool>(bit);
-                    if (b) {
-                        s_vec[i] *= round_challenges_inv[log_poly_degree - 1 - j];
-                    }
-                }
-            }, thread_heuristics::FF_MULTIPLICATION_COST * log_poly_degree);
+        return { poly_length, std::move(round_challenges_inv), C_zero, aux_generator, a_zero, b_zero };
+    }
 
-        std::span<const Commitment> srs_elements = vk->get_monomial_points();
-        if (poly_length * 2 > srs_elements.size()) {
-            throw_or_abort("potential bug: Not enough SRS points for IPA!");
+    /**
+     * @brief Compute \f$scale\cdot\vec{s}\f$, where \f$\vec{s}=(1,u_{0}^{-1},u_{1}^{-1},u_{0}^{-1}u_{1}^{-1},...,\prod_{i=0}^{k-1}u_{i}^{-1})\f$
+     *
+     * @details \f$s_i\f$ is the product of the \f$u_j^{-1}\f$ for the bits \f$j\f$ set in \f$i\f$, so the vector is built as a
+     * tree of products: the entries with the top \f$j+1\f$ bits clear are known after \f$j\f$ doublings, and the next doubling
+     * multiplies all of them by the next challenge. This takes \f$d\f$ multiplications rather than \f$d\log d\f$.
+     */
+    static std::vector<Fr> compute_s_vec(const std::vector<Fr>& round_challenges_inv, size_t poly_length, const Fr& scale)
+    {
+        const size_t log_poly_degree = round_challenges_inv.size();
+        std::vector<Fr> s_vec(poly_length);
+        s_vec[0] = scale;
+        for (size_t j = 0; j < log_poly_degree; j++) {
+            const size_t half = size_t(1) << j;
+            const Fr& challenge_inv = round_challenges_inv[log_poly_degree - 1 - j];
+            parallel_for_heuristic(
+                half,
+                [&](size_t i) {
+                    s_vec[half + i] = s_vec[i] * challenge_inv;
+                }, thread_heuristics::FF_MULTIPLICATION_COST + thread_heuristics::FF_COPY_COST);
         }
-        // Copy the G_vector to local memory.
-        std::vector<Commitment> G_vec_local(poly_length);
+        return s_vec;
+    }
 
-        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
-        // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
-        // G_vec_local should use only the original SRS thus we extract only the even indices.
+    /**
+     * @brief Copy the first poly_length points of the original SRS to local memory
+     *
+     * @details The SRS stored in the commitment key is the result after applying the pippenger point table so the
+     * values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
+     * G_vec_local should use only the original SRS thus we extract only the even indices.
+     */
+    static std::vector<Commitment> get_G_vec(std::span<const Commitment> srs_elements, size_t poly_length)
+    {
+        std::vector<Commitment> G_vec_local(poly_length);
         parallel_for_heuristic(
             poly_length,
             [&](size_t i) {
                 G_vec_local[i] = srs_elements[i * 2];
             }, thread_heuristics::FF_COPY_COST * 2);
-
-        // Step 8.
-        // Compute G₀
-        Commitment G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-            {&s_vec[0], /*size*/ poly_length}, {&G_vec_local[0], /*size*/ poly_length}, vk->pippenger_runtime_state);
-
-        // Step 9.
-        // Receive a₀ from the prover
-        auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
-
-        // Step 10.
-        // Compute C_right
-        GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
-
-        // Step 11.
-        // Check if C_right == C₀
-        return (C_zero.normalize() == right_hand_side.normalize());
+        return G_vec_local;
     }
     /**
      * @brief  Recursively verify the correctness of an IPA proof. Unlike native verification, there is no
@@ -623,6 +683,81 @@ template <typename Curve_> class IPA {
         const auto opening_claim = reduce_batch_opening_claim(batch_opening_claim);
         return reduce_verify_internal(vk, opening_claim, transcript);
     }
+
+    /**
+     * @brief Verify an IPA proof up to the computation of \f$G_s\f$ and add the resulting claim to the accumulator
+     *
+     * @details The claims are checked, with one MSM for all of them, when the accumulator is discharged. Any proof
+     * that is rejected before \f$G_s\f$ is needed (e.g. for a zero challenge) aborts here as it would in
+     * reduce_verify.
+     *
+     * @param accumulator The claims deferred so far
+     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param opening_claim Contains the commitment C and opening pair \f$(\beta, f(\beta))\f$
+     * @param transcript Transcript with elements from the prover and generated challenges
+     */
+    static void defer_verify(BatchAccumulator& accumulator,
+                             const std::shared_ptr<VK>& vk,
+                             const OpeningClaim<Curve>& opening_claim,
+                             const auto& transcript)
+        requires(!Curve::is_stdlib_type)
+    {
+        accumulator.claims.emplace_back(reduce_verify_to_deferred_claim(vk, opening_claim, transcript));
+    }
+
+    /**
+     * @brief Check all the claims deferred to the accumulator at once, and empty it
+     *
+     * @details Each claim \f$i\f$ holds if \f$C_0^{(i)}-a_0^{(i)}b_0^{(i)}U^{(i)}=a_0^{(i)}\langle\vec{s}^{(i)},\vec{G}\rangle\f$.
+     * The checks are combined with random coefficients \f$\rho_i\f$ into
+     *
+     *      \f$\sum_i\rho_i(C_0^{(i)}-a_0^{(i)}b_0^{(i)}U^{(i)})=\langle\sum_i\rho_ia_0^{(i)}\vec{s}^{(i)},\vec{G}\rangle\f$,
+     *
+     * which holds with overwhelming probability only if all of them do. The vectors \f$\vec{s}^{(i)}\f$ (padded with
+     * zeros to the longest of them) are summed in the scalar field, so the linear-size MSM over \f$\vec{G}\f$ is done
+     * once for the batch rather than once per proof.
+     *
+     * @return true if all the deferred claims hold (or there are none)
+     */
+    static VerifierAccumulator discharge_accumulator(const std::shared_ptr<VK>& vk, BatchAccumulator& accumulator)
+        requires(!Curve::is_stdlib_type)
+    {
+        if (accumulator.empty()) {
+            return true;
+        }
+
+        size_t max_poly_length = 0;
+        for (const auto& claim : accumulator.claims) {
+            max_poly_length = std::max(max_poly_length, claim.poly_length);
+        }
+        std::span<const Commitment> srs_elements = vk->get_monomial_points();
+        if (max_poly_length * 2 > srs_elements.size()) {
+            throw_or_abort("potential bug: Not enough SRS points for IPA!");
+        }
+
+        // Combine the claims: ∑ ρᵢ(C₀ - a₀b₀U) on the left and ∑ ρᵢa₀s⃗ on the right
+        GroupElement left_hand_side = GroupElement::infinity();
+        std::vector<Fr> combined_s_vec(max_poly_length, Fr::zero());
+        for (const auto& claim : accumulator.claims) {
+            const Fr batching_coefficient = Fr::random_element();
+            left_hand_side += (claim.C_zero - claim.aux_generator * (claim.a_zero * claim.b_zero)) * batching_coefficient;
+
+            const std::vector<Fr> s_vec =
+                compute_s_vec(claim.round_challenges_inv, claim.poly_length, batching_coefficient * claim.a_zero);
+            parallel_for_heuristic(
+                claim.poly_length,
+                [&](size_t i) {
+                    combined_s_vec[i] += s_vec[i];
+                }, thread_heuristics::FF_ADDITION_COST);
+        }
+        accumulator.claims.clear();
+
+        std::vector<Commitment> G_vec_local = get_G_vec(srs_elements, max_poly_length);
+        GroupElement right_hand_side = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
+            {&combined_s_vec[0], /*size*/ max_poly_length}, {&G_vec_local[0], /*size*/ max_poly_length}, vk->pippenger_runtime_state);
+
+        return (left_hand_side.normalize() == right_hand_side.normalize());
+    }
 };
 
 } // namespace bb
\ No newline at end of file
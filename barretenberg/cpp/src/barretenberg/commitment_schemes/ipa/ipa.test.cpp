@@ -230,6 +230,46 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+/**
+ * @brief Claims deferred to an accumulator, from polynomials of different sizes, are checked together when it is
+ * discharged, and a single wrong claim makes the whole batch fail
+ */
+TEST_F(IPATest, DeferAndDischargeAccumulator)
+{
+    using IPA = IPA<Curve>;
+
+    auto defer_opening = [&](IPA::BatchAccumulator& accumulator, size_t n, bool valid) {
+        auto poly = Polynomial::random(n);
+        auto [x, eval] = this->random_eval(poly);
+        auto commitment = this->commit(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA::compute_opening_proof(this->ck(), { poly, opening_pair }, prover_transcript);
+
+        auto verifier_transcript = std::make_shared<NativeTranscript>(prover_transcript->proof_data);
+        const OpeningClaim<Curve> opening_claim{ { x, valid ? eval : eval + Fr::one() }, commitment };
+        IPA::defer_verify(accumulator, this->vk(), opening_claim, verifier_transcript);
+        EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
+    };
+
+    IPA::BatchAccumulator accumulator;
+    EXPECT_TRUE(IPA::discharge_accumulator(this->vk(), accumulator));
+
+    for (size_t n : { 128UL, 32UL, 128UL, 2UL, 64UL }) {
+        defer_opening(accumulator, n, /*valid=*/true);
+    }
+    EXPECT_EQ(accumulator.size(), 5);
+    EXPECT_TRUE(IPA::discharge_accumulator(this->vk(), accumulator));
+    EXPECT_TRUE(accumulator.empty());
+
+    for (size_t n : { 128UL, 64UL, 128UL }) {
+        defer_opening(accumulator, n, /*valid=*/n != 64);
+    }
+    EXPECT_FALSE(IPA::discharge_accumulator(this->vk(), accumulator));
+    EXPECT_TRUE(accumulator.empty());
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     using IPA = IPA<Curve>;
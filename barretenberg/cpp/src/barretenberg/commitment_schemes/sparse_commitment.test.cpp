@@ -269,4 +269,89 @@ TYPED_TEST(CommitmentKeyTest, CommitStructuredNonzeroComplement)
     EXPECT_EQ(result, expected_result);
 }
 
+/**
+ * @brief Test that batch_commit and commit_serial agree with commit on a mix of small, sparse, dense and zero
+ * polynomials
+ *
+ */
+TYPED_TEST(CommitmentKeyTest, BatchCommit)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 13; // large enough for the dense polynomials to be committed to with pippenger
+
+    std::vector<Polynomial> polys;
+    // Dense random polynomial
+    polys.emplace_back(Polynomial::random(num_points));
+    // Sparse polynomials, both above and below the threshold for the single threaded MSM
+    for (size_t num_nonzero : { size_t(1), size_t(7), size_t(300), size_t(3000) }) {
+        Polynomial poly{ num_points };
+        for (size_t i = 0; i < num_nonzero; ++i) {
+            poly.at((i * 7 + 3) % num_points) = Fr::random_element();
+        }
+        polys.emplace_back(std::move(poly));
+    }
+    // Small dense polynomial with a nonzero start index
+    const size_t offset = 1 << 11;
+    Polynomial shifted_poly(100, num_points, offset);
+    for (size_t i = offset; i < offset + 100; ++i) {
+        shifted_poly.at(i) = Fr::random_element();
+    }
+    polys.emplace_back(std::move(shifted_poly));
+    // Zero polynomial
+    polys.emplace_back(num_points);
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    std::vector<PolynomialSpan<const Fr>> spans(polys.begin(), polys.end());
+    std::vector<G1> results = key->batch_commit(spans);
+
+    ASSERT_EQ(results.size(), polys.size());
+    for (size_t i = 0; i < polys.size(); ++i) {
+        EXPECT_EQ(results[i], key->commit(polys[i]));
+        EXPECT_EQ(key->commit_serial(polys[i]), results[i]);
+    }
+}
+
+/**
+ * @brief Test that commit gives the same result with the fixed-base MSM tables of the SRS as with pippenger
+ *
+ */
+TYPED_TEST(CommitmentKeyTest, CommitWithFixedBaseMsm)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+    using FixedBaseMsm = scalar_multiplication::FixedBaseMsm<Curve>;
+
+    const size_t num_points = FixedBaseMsm::MIN_NUM_POINTS;
+    const size_t bits_per_window = 14;
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    Polynomial poly = Polynomial::random(num_points);
+    Polynomial shifted_poly(num_points / 2, num_points, num_points / 4);
+    for (size_t i = num_points / 4; i < 3 * num_points / 4; ++i) {
+        shifted_poly.at(i) = Fr::random_element();
+    }
+    G1 expected = key->commit(poly);
+    G1 expected_shifted = key->commit(shifted_poly);
+
+    // A budget that covers the first num_points points of the SRS
+    scalar_multiplication::set_fixed_base_msm_memory_budget(FixedBaseMsm::get_table_size(num_points, bits_per_window));
+    auto fixed_base_msm = srs::get_crs_factory<Curve>()->get_prover_crs(num_points)->get_fixed_base_msm();
+    ASSERT_NE(fixed_base_msm, nullptr);
+    EXPECT_GE(fixed_base_msm->get_num_points(), num_points);
+    EXPECT_TRUE(fixed_base_msm->is_efficient_for(num_points));
+    G1 result = key->commit(poly);
+    G1 result_shifted = key->commit(shifted_poly);
+    scalar_multiplication::set_fixed_base_msm_memory_budget(0);
+
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(result_shifted, expected_shifted);
+}
+
 } // namespace bb
@@ -0,0 +1,278 @@
+#ifndef NO_MULTITHREADING
+#include "log.hpp"
+#include "thread.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "barretenberg/common/compiler_hints.hpp"
+
+namespace {
+
+/**
+ * One call to parallel_for. Lives on the stack of the calling thread, which does not return until every iteration
+ * has been executed, so tasks can safely hold a raw pointer to it.
+ */
+struct Job {
+    const std::function<void(size_t)>* func;
+    std::atomic<size_t> remaining;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool done = false;
+
+    Job(const std::function<void(size_t)>& f, size_t num_iterations)
+        : func(&f)
+        , remaining(num_iterations)
+    {}
+
+    void complete(size_t num_iterations)
+    {
+        if (remaining.fetch_sub(num_iterations, std::memory_order_acq_rel) == num_iterations) {
+            // Notify while holding the lock: the waiter may destroy the job as soon as it observes `done`.
+            std::unique_lock<std::mutex> lock(mutex);
+            done = true;
+            condition.notify_all();
+        }
+    }
+};
+
+/**
+ * A contiguous range of iterations [begin, end) of a job. Executing a range splits it in half, leaving the upper half
+ * on the executing thread's deque so that idle threads can steal it.
+ */
+struct Task {
+    Job* job = nullptr;
+    size_t begin = 0;
+    size_t end = 0;
+};
+
+/**
+ * Double ended task queue. The owner pushes and pops at the back (LIFO, good cache locality for nested work),
+ * thieves take from the front (FIFO, steals the largest remaining ranges first).
+ */
+class TaskDeque {
+  public:
+    void push(const Task& task)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        tasks_.push_back(task);
+    }
+
+    bool pop(Task& task)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (tasks_.empty()) {
+            return false;
+        }
+        task = tasks_.back();
+        tasks_.pop_back();
+        return true;
+    }
+
+    bool steal(Task& task)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (tasks_.empty()) {
+            return false;
+        }
+        task = tasks_.front();
+        tasks_.pop_front();
+        return true;
+    }
+
+  private:
+    std::mutex mutex_;
+    std::deque<Task> tasks_;
+};
+
+class WorkStealingPool {
+  public:
+    WorkStealingPool(size_t num_threads);
+    WorkStealingPool(const WorkStealingPool& other) = delete;
+    WorkStealingPool(WorkStealingPool&& other) = delete;
+    ~WorkStealingPool();
+
+    WorkStealingPool& operator=(const WorkStealingPool& other) = delete;
+    WorkStealingPool& operator=(WorkStealingPool&& other) = delete;
+
+    void run(size_t num_iterations, const std::function<void(size_t)>& func);
+
+  private:
+    // Number of failed attempts to find work before a thread parks.
+    static constexpr size_t SPIN_ATTEMPTS = 64;
+
+    std::vector<std::thread> workers_;
+    // One deque per worker, plus a shared one for threads that are not part of the pool.
+    std::vector<std::unique_ptr<TaskDeque>> deques_;
+    TaskDeque injection_queue_;
+
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_condition_;
+    std::atomic<size_t> work_epoch_ = 0;
+    std::atomic<size_t> num_sleeping_ = 0;
+    bool stop_ = false;
+
+    // Index of the current thread's deque, or npos if this thread is not a pool worker.
+    static constexpr size_t npos = static_cast<size_t>(-1);
+    static thread_local size_t worker_index_;
+
+    TaskDeque& local_deque() { return worker_index_ == npos ? injection_queue_ : *deques_[worker_index_]; }
+
+    BB_NO_PROFILE void worker_loop(size_t thread_index);
+    void push(const Task& task);
+    bool find_task(Task& task);
+    void execute(Task task);
+    void notify();
+};
+
+thread_local size_t WorkStealingPool::worker_index_ = WorkStealingPool::npos;
+
+WorkStealingPool::WorkStealingPool(size_t num_threads)
+{
+    deques_.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        deques_.emplace_back(std::make_unique<TaskDeque>());
+    }
+    workers_.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        workers_.emplace_back(&WorkStealingPool::worker_loop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        stop_ = true;
+    }
+    sleep_condition_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::notify()
+{
+    work_epoch_.fetch_add(1, std::memory_order_seq_cst);
+    if (num_sleeping_.load(std::memory_order_seq_cst) != 0) {
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        sleep_condition_.notify_one();
+    }
+}
+
+void WorkStealingPool::push(const Task& task)
+{
+    local_deque().push(task);
+    notify();
+}
+
+bool WorkStealingPool::find_task(Task& task)
+{
+    if (local_deque().pop(task)) {
+        return true;
+    }
+    if (worker_index_ != npos && injection_queue_.steal(task)) {
+        return true;
+    }
+    // Start at a different victim per thread so thieves don't all hammer the same deque.
+    const size_t num_deques = deques_.size();
+    const size_t start = worker_index_ == npos ? 0 : worker_index_ + 1;
+    for (size_t i = 0; i < num_deques; ++i) {
+        const size_t victim = (start + i) % num_deques;
+        if (victim != worker_index_ && deques_[victim]->steal(task)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::execute(Task task)
+{
+    // Keep splitting off the upper half until only a single iteration is left, so that any idle thread can pick up
+    // part of the range. This bounds the per-iteration overhead to O(log n) deque operations.
+    while (task.end - task.begin > 1) {
+        const size_t mid = task.begin + (task.end - task.begin) / 2;
+        push(Task{ task.job, mid, task.end });
+        task.end = mid;
+    }
+    (*task.job->func)(task.begin);
+    task.job->complete(1);
+}
+
+void WorkStealingPool::run(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    if (num_iterations == 0) {
+        return;
+    }
+    Job job(func, num_iterations);
+    execute(Task{ &job, 0, num_iterations });
+
+    // Help out until our job is complete. This may execute tasks from other (e.g. outer) jobs, which is what makes
+    // nested parallel_for calls safe: a waiting thread never blocks while there is runnable work it could do.
+    size_t failed_attempts = 0;
+    while (job.remaining.load(std::memory_order_acquire) != 0) {
+        Task task;
+        if (find_task(task)) {
+            execute(task);
+            failed_attempts = 0;
+        } else if (++failed_attempts < SPIN_ATTEMPTS) {
+            std::this_thread::yield();
+        } else {
+            // All remaining iterations are running on other threads. Park until they finish.
+            break;
+        }
+    }
+    std::unique_lock<std::mutex> lock(job.mutex);
+    job.condition.wait(lock, [&job] { return job.done; });
+}
+
+void WorkStealingPool::worker_loop(size_t thread_index)
+{
+    worker_index_ = thread_index;
+    while (true) {
+        const size_t epoch = work_epoch_.load(std::memory_order_seq_cst);
+        Task task;
+        bool found = false;
+        for (size_t i = 0; i < SPIN_ATTEMPTS && !found; ++i) {
+            found = find_task(task);
+            if (!found) {
+                std::this_thread::yield();
+            }
+        }
+        if (found) {
+            execute(task);
+            continue;
+        }
+        // Nothing to do: park instead of spinning, so that an idle pool doesn't burn cores other processes need.
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        num_sleeping_.fetch_add(1, std::memory_order_seq_cst);
+        sleep_condition_.wait(lock,
+                              [&] { return stop_ || work_epoch_.load(std::memory_order_seq_cst) != epoch; });
+        num_sleeping_.fetch_sub(1, std::memory_order_seq_cst);
+        if (stop_) {
+            break;
+        }
+    }
+}
+} // namespace
+
+namespace bb {
+/**
+ * A work-stealing strategy. Every worker owns a deque of iteration ranges; a range being executed is split in half
+ * repeatedly, with the halves pushed for other threads to steal. Threads waiting for a parallel_for to complete
+ * execute pending tasks rather than spinning, and park on a condition variable when there is nothing left to run.
+ * Unlike the other pools, nested calls to parallel_for (e.g. from inside a parallel_for_range chunk) are supported.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    static WorkStealingPool pool(get_num_cpus() - 1);
+
+    pool.run(num_iterations, func);
+}
+} // namespace bb
+#endif
@@ -34,6 +34,9 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: "work_stealing" parks idle threads instead of spinning and supports nested parallel_for calls, which makes
+ * it friendlier to hosts shared by several provers. It can be selected with -DWORK_STEALING_MULTITHREADING=ON.
  */
 
 namespace bb {
@@ -69,6 +72,8 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -78,6 +83,8 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
 #else
 #ifndef NO_OMP_MULTITHREADING
     parallel_for_omp(num_iterations, func);
+#elif defined(WORK_STEALING_MULTITHREADING)
+    parallel_for_work_stealing(num_iterations, func);
 #else
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
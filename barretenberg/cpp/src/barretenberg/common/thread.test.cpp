@@ -0,0 +1,50 @@
+#include "thread.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace bb;
+
+#ifndef NO_MULTITHREADING
+namespace bb {
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+}
+
+TEST(ParallelFor, WorkStealingVisitsEveryIterationOnce)
+{
+    for (size_t num_iterations : { 0UL, 1UL, 7UL, 64UL, 1000UL }) {
+        std::vector<std::atomic<size_t>> visits(num_iterations);
+        parallel_for_work_stealing(num_iterations, [&](size_t i) { visits[i]++; });
+        for (auto& count : visits) {
+            EXPECT_EQ(count.load(), 1UL);
+        }
+    }
+}
+
+TEST(ParallelFor, WorkStealingNested)
+{
+    constexpr size_t OUTER = 13;
+    constexpr size_t INNER = 29;
+    std::vector<std::atomic<size_t>> visits(OUTER * INNER);
+    parallel_for_work_stealing(OUTER, [&](size_t i) {
+        parallel_for_work_stealing(INNER, [&](size_t j) { visits[i * INNER + j]++; });
+    });
+    for (auto& count : visits) {
+        EXPECT_EQ(count.load(), 1UL);
+    }
+}
+#endif
+
+TEST(ParallelFor, RangeCoversAllPoints)
+{
+    constexpr size_t NUM_POINTS = 12345;
+    std::vector<std::atomic<size_t>> visits(NUM_POINTS);
+    parallel_for_range(NUM_POINTS, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            visits[i]++;
+        }
+    });
+    for (auto& count : visits) {
+        EXPECT_EQ(count.load(), 1UL);
+    }
+}
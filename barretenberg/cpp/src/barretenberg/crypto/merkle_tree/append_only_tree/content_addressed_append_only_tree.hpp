@@ -8,15 +8,19 @@
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
 #include "barretenberg/crypto/merkle_tree/signal.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <ostream>
 #include <random>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -42,6 +46,7 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     using AppendCompletionCallback = std::function<void(const TypedResponse<AddDataResponse>&)>;
     using MetaDataCallback = std::function<void(const TypedResponse<TreeMetaResponse>&)>;
     using HashPathCallback = std::function<void(const TypedResponse<GetSiblingPathResponse>&)>;
+    using HashPathsCallback = std::function<void(const TypedResponse<GetSiblingPathsResponse>&)>;
     using FindLeafCallback = std::function<void(const TypedResponse<FindLeafIndexResponse>&)>;
     using GetLeafCallback = std::function<void(const TypedResponse<GetLeafResponse>&)>;
     using CommitCallback = std::function<void(const Response&)>;
@@ -60,6 +65,12 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     ContentAddressedAppendOnlyTree& operator=(ContentAddressedAppendOnlyTree const&& other) = delete;
     virtual ~ContentAddressedAppendOnlyTree() = default;
 
+    /**
+     * @brief Returns a tree on a snapshot of this fork's store (see ContentAddressedCachedTreeStore::create_snapshot)
+     * Synchronous, it neither reads from the persisted store nor computes any hashes.
+     */
+    std::unique_ptr<ContentAddressedAppendOnlyTree> create_snapshot() const;
+
     /**
      * @brief Adds a single value to the end of the tree
      * @param value The value to be added
@@ -94,6 +105,29 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
                           const HashPathCallback& on_completion,
                           bool includeUncommitted) const;
 
+    /**
+     * @brief Returns the sibling paths from the leaves at the given indices to the root. The paths are read in one
+     * transaction and the nodes that they have in common are only read once.
+     * @param indices The indices at which to read the sibling paths
+     * @param on_completion Callback to be called on completion
+     * @param includeUncommitted Whether to include uncommitted changes
+     */
+    void get_sibling_paths(const std::vector<index_t>& indices,
+                           const HashPathsCallback& on_completion,
+                           bool includeUncommitted) const;
+
+    /**
+     * @brief Returns the sibling paths from the leaves at the given indices to the root, as of the given block
+     * @param indices The indices at which to read the sibling paths
+     * @param blockNumber The block number of the tree to use as a reference
+     * @param on_completion Callback to be called on completion
+     * @param includeUncommitted Whether to include uncommitted changes
+     */
+    void get_sibling_paths(const std::vector<index_t>& indices,
+                           const index_t& blockNumber,
+                           const HashPathsCallback& on_completion,
+                           bool includeUncommitted) const;
+
     /**
      * @brief Get the subtree sibling path object
      *
@@ -210,6 +244,9 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
 
     using OptionalSiblingPath = std::vector<std::optional<fr>>;
 
+    // Takes the tree's parameters and zero hashes from another tree of the same shape rather than computing them
+    ContentAddressedAppendOnlyTree(std::unique_ptr<Store> store, const ContentAddressedAppendOnlyTree& other);
+
     fr_sibling_path optional_sibling_path_to_full_sibling_path(const OptionalSiblingPath& optionalPath) const;
 
     void add_values_internal(std::shared_ptr<std::vector<fr>> values,
@@ -221,6 +258,10 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
                              const AppendCompletionCallback& on_completion,
                              bool update_index);
 
+    std::vector<fr_sibling_path> get_sibling_paths_internal(const std::vector<index_t>& indices,
+                                                            const RequestContext& requestContext,
+                                                            ReadTransaction& tx) const;
+
     OptionalSiblingPath get_subtree_sibling_path_internal(const index_t& leaf_index,
                                                           uint32_t subtree_depth,
                                                           const RequestContext& requestContext,
@@ -236,6 +277,11 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     void add_batch_internal(
         std::vector<fr>& values, fr& new_root, index_t& new_size, bool update_index, ReadTransaction& tx);
 
+    void hash_level(const std::vector<fr>& children, std::vector<fr>& parents, uint32_t num_parents) const;
+
+    // Minimum number of hashes given to a worker when a level of a batch is hashed in parallel
+    static constexpr uint32_t MIN_HASHES_PER_CHUNK = 32;
+
     std::unique_ptr<Store> store_;
     uint32_t depth_;
     uint64_t max_size_;
@@ -243,6 +289,25 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     std::shared_ptr<ThreadPool> workers_;
 };
 
+template <typename Store, typename HashingPolicy>
+ContentAddressedAppendOnlyTree<Store, HashingPolicy>::ContentAddressedAppendOnlyTree(
+    std::unique_ptr<Store> store, const ContentAddressedAppendOnlyTree& other)
+    : store_(std::move(store))
+    , depth_(other.depth_)
+    , max_size_(other.max_size_)
+    , zero_hashes_(other.zero_hashes_)
+    , workers_(other.workers_)
+{}
+
+template <typename Store, typename HashingPolicy>
+std::unique_ptr<ContentAddressedAppendOnlyTree<Store, HashingPolicy>> ContentAddressedAppendOnlyTree<
+    Store,
+    HashingPolicy>::create_snapshot() const
+{
+    return std::unique_ptr<ContentAddressedAppendOnlyTree>(
+        new ContentAddressedAppendOnlyTree(store_->create_snapshot(), *this));
+}
+
 template <typename Store, typename HashingPolicy>
 ContentAddressedAppendOnlyTree<Store, HashingPolicy>::ContentAddressedAppendOnlyTree(
     std::unique_ptr<Store> store, std::shared_ptr<ThreadPool> workers, const std::vector<fr>& initial_values)
@@ -385,6 +450,54 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_path(cons
     workers_->enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths(const std::vector<index_t>& indices,
+                                                                             const HashPathsCallback& on_completion,
+                                                                             bool includeUncommitted) const
+{
+    auto job = [=, this]() {
+        execute_and_report<GetSiblingPathsResponse>(
+            [=, this](TypedResponse<GetSiblingPathsResponse>& response) {
+                ReadTransactionPtr tx = store_->create_read_transaction();
+                RequestContext requestContext;
+                requestContext.includeUncommitted = includeUncommitted;
+                requestContext.root = store_->get_current_root(*tx, includeUncommitted);
+                response.inner.paths = get_sibling_paths_internal(indices, requestContext, *tx);
+            },
+            on_completion);
+    };
+    workers_->enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths(const std::vector<index_t>& indices,
+                                                                             const index_t& blockNumber,
+                                                                             const HashPathsCallback& on_completion,
+                                                                             bool includeUncommitted) const
+{
+    auto job = [=, this]() {
+        execute_and_report<GetSiblingPathsResponse>(
+            [=, this](TypedResponse<GetSiblingPathsResponse>& response) {
+                if (blockNumber == 0) {
+                    throw std::runtime_error("Invalid block number");
+                }
+                ReadTransactionPtr tx = store_->create_read_transaction();
+                BlockPayload blockData;
+                if (!store_->get_block_data(blockNumber, blockData, *tx)) {
+                    throw std::runtime_error("Data for block unavailable");
+                }
+
+                RequestContext requestContext;
+                requestContext.blockNumber = blockNumber;
+                requestContext.includeUncommitted = includeUncommitted;
+                requestContext.root = blockData.root;
+                response.inner.paths = get_sibling_paths_internal(indices, requestContext, *tx);
+            },
+            on_completion);
+    };
+    workers_->enqueue(job);
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_subtree_sibling_path(
     const uint32_t subtree_depth, const HashPathCallback& on_completion, bool includeUncommitted) const
@@ -506,6 +619,58 @@ std::optional<fr> ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_lea
     return std::optional<fr>(hash);
 }
 
+template <typename Store, typename HashingPolicy>
+std::vector<fr_sibling_path> ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths_internal(
+    const std::vector<index_t>& indices, const RequestContext& requestContext, ReadTransaction& tx) const
+{
+    std::vector<fr_sibling_path> paths(indices.size());
+    if (indices.empty()) {
+        return paths;
+    }
+    // Walk the paths in order of leaf index, so that each path shares as many of its upper nodes as possible with the
+    // previous one
+    std::vector<size_t> order(indices.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return indices[a] < indices[b]; });
+
+    // The nodes on the previous path, from the root down
+    std::vector<NodePayload> nodes(depth_);
+    index_t previous_index = indices[order[0]];
+    bool first = true;
+    for (size_t position : order) {
+        const index_t leaf_index = indices[position];
+        // The node at a level is shared with the previous path if the leaf indices agree on that many of their top bits
+        uint32_t shared_levels = 0;
+        if (!first) {
+            const index_t diff = leaf_index ^ previous_index;
+            shared_levels = 1;
+            while (shared_levels < depth_ && ((diff >> (depth_ - shared_levels)) & 1) == 0) {
+                ++shared_levels;
+            }
+        }
+        first = false;
+        previous_index = leaf_index;
+
+        fr_sibling_path& path = paths[position];
+        path.resize(depth_);
+        fr hash = requestContext.root;
+        for (uint32_t level = 0; level < depth_; ++level) {
+            NodePayload& nodePayload = nodes[level];
+            if (level >= shared_levels) {
+                // A node that is not found has no children, its children are then the zero hashes
+                nodePayload = NodePayload();
+                store_->get_node_by_hash(hash, nodePayload, tx, requestContext.includeUncommitted);
+            }
+            bool is_right = static_cast<bool>((leaf_index >> (depth_ - 1 - level)) & 1);
+            std::optional<fr> sibling = is_right ? nodePayload.left : nodePayload.right;
+            std::optional<fr> child = is_right ? nodePayload.right : nodePayload.left;
+            hash = child.has_value() ? child.value() : zero_hashes_[level + 1];
+            path[depth_ - 1 - level] = sibling.has_value() ? sibling.value() : zero_hashes_[level + 1];
+        }
+    }
+    return paths;
+}
+
 template <typename Store, typename HashingPolicy>
 ContentAddressedAppendOnlyTree<Store, HashingPolicy>::OptionalSiblingPath ContentAddressedAppendOnlyTree<
     Store,
@@ -825,6 +990,56 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_values_internal(s
     }
 }
 
+/**
+ * @brief Computes parents[i] = hash(children[2i], children[2i + 1]) for i < num_parents
+ * @details Large levels are split into chunks which are claimed by the calling thread and by helper jobs enqueued on
+ * the tree's worker pool. The calling thread is itself usually a pool worker, so it never blocks waiting for a helper
+ * to start: it keeps claiming chunks until none are left and then only waits for chunks already being hashed. Helpers
+ * that start after all chunks have been claimed return immediately. The result is identical to hashing sequentially.
+ * Each chunk is hashed with HashingPolicy::hash_pairs, which can hash several pairs together.
+ */
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::hash_level(const std::vector<fr>& children,
+                                                                      std::vector<fr>& parents,
+                                                                      uint32_t num_parents) const
+{
+    const auto max_chunks = static_cast<uint32_t>(workers_->num_threads()) + 1;
+    const uint32_t num_chunks = std::max(1U, std::min(max_chunks, num_parents / MIN_HASHES_PER_CHUNK));
+    if (num_chunks == 1) {
+        HashingPolicy::hash_pairs(std::span(children.data(), num_parents * 2UL),
+                                  std::span(parents.data(), num_parents));
+        return;
+    }
+
+    // Shared with the helper jobs, which may outlive this call
+    struct LevelHashState {
+        std::atomic<uint32_t> next_chunk;
+        Signal chunks_remaining;
+        LevelHashState(uint32_t num_chunks)
+            : next_chunk(0)
+            , chunks_remaining(num_chunks)
+        {}
+    };
+    auto state = std::make_shared<LevelHashState>(num_chunks);
+
+    const uint32_t chunk_size = (num_parents + num_chunks - 1) / num_chunks;
+    auto hash_chunks = [state, num_chunks, chunk_size, num_parents, in = children.data(), out = parents.data()]() {
+        uint32_t chunk = 0;
+        while ((chunk = state->next_chunk.fetch_add(1)) < num_chunks) {
+            const uint32_t start = chunk * chunk_size;
+            const uint32_t end = std::min(start + chunk_size, num_parents);
+            HashingPolicy::hash_pairs(std::span(in + start * 2UL, (end - start) * 2UL),
+                                      std::span(out + start, end - start));
+            state->chunks_remaining.signal_decrement();
+        }
+    };
+    for (uint32_t i = 1; i < num_chunks; ++i) {
+        workers_->enqueue(hash_chunks);
+    }
+    hash_chunks();
+    state->chunks_remaining.wait_for_level(0);
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
     std::vector<fr>& values, fr& new_root, index_t& new_size, bool update_index, ReadTransaction& tx)
@@ -864,22 +1079,20 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
         }
     }
 
-    // Hash the values as a sub tree and insert them
+    // Hash the values as a sub tree and insert them. Each level is hashed (in parallel for large batches) before its
+    // nodes are written to the store in order
+    std::vector<fr> parents(number_to_insert >> 1);
     while (number_to_insert > 1) {
         number_to_insert >>= 1;
         index >>= 1;
         --level;
-        // std::cout << "To INSERT " << number_to_insert << std::endl;
+        hash_level(hashes_local, parents, number_to_insert);
         for (uint32_t i = 0; i < number_to_insert; ++i) {
-            fr left = hashes_local[i * 2];
-            fr right = hashes_local[i * 2 + 1];
-            hashes_local[i] = HashingPolicy::hash_pair(left, right);
-            // std::cout << "Left: " << left << ", right: " << right << ", parent: " << hashes_local[i] << std::endl;
-            store_->put_node_by_hash(hashes_local[i], { .left = left, .right = right, .ref = 1 });
-            store_->put_cached_node_by_index(level, index + i, hashes_local[i]);
-            // std::cout << "Writing node hash " << hashes_local[i] << " level " << level << " index " << index + i
-            //           << std::endl;
+            store_->put_node_by_hash(parents[i],
+                                     { .left = hashes_local[i * 2], .right = hashes_local[i * 2 + 1], .ref = 1 });
+            store_->put_cached_node_by_index(level, index + i, parents[i]);
         }
+        std::swap(hashes_local, parents);
     }
 
     fr new_hash = hashes_local[0];
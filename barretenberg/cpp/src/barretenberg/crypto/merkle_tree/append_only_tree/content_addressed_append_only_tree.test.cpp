@@ -796,6 +796,34 @@ TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_add_multiple_values_in_a
     check_sibling_path(tree, 4 - 1, memdb.get_sibling_path(4 - 1));
 }
 
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_add_large_batch_with_parallel_hashing)
+{
+    // Large enough for the levels of the inserted subtrees to be hashed by several workers
+    constexpr size_t depth = 12;
+    constexpr size_t num_values = 3000;
+    std::string name = random_string();
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    ThreadPoolPtr pool = make_thread_pool(8);
+    TreeType tree(std::move(store), pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    std::vector<fr> to_add;
+    for (size_t i = 0; i < num_values; ++i) {
+        fr value = fr(i * 7 + 3);
+        memdb.update_element(i, value);
+        to_add.push_back(value);
+    }
+    add_values(tree, to_add);
+    check_size(tree, num_values);
+    check_root(tree, memdb.root());
+    check_sibling_path(tree, 0, memdb.get_sibling_path(0));
+    check_sibling_path(tree, 2047, memdb.get_sibling_path(2047));
+    check_sibling_path(tree, num_values - 1, memdb.get_sibling_path(num_values - 1));
+    commit_tree(tree);
+    check_root(tree, memdb.root(), false);
+}
+
 TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_commit_multiple_blocks)
 {
     constexpr size_t depth = 10;
@@ -1123,6 +1151,56 @@ TEST_F(PersistedContentAddressedAppendOnlyTreeTest, returns_sibling_path)
     }
 }
 
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, returns_multiple_sibling_paths)
+{
+    constexpr size_t depth = 6;
+    std::string name = random_string();
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    ThreadPoolPtr pool = make_thread_pool(1);
+    TreeType tree(std::move(store), pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    std::vector<fr> values = create_values(20);
+    add_values(tree, values);
+    for (size_t i = 0; i < values.size(); ++i) {
+        memdb.update_element(i, values[i]);
+    }
+    commit_tree(tree);
+    // Leave some of the values uncommitted
+    add_values(tree, { 30, 31 });
+    fr_sibling_path committed_path = memdb.get_sibling_path(7);
+    memdb.update_element(20, 30);
+    memdb.update_element(21, 31);
+
+    // Unordered, repeated, neighbouring and distant indices, including leaves that are not yet in the tree
+    std::vector<index_t> indices = { 7, 0, 21, 7, 63, 1, 40, 19, 20 };
+    Signal signal;
+    tree.get_sibling_paths(
+        indices,
+        [&](const TypedResponse<GetSiblingPathsResponse>& response) {
+            EXPECT_EQ(response.success, true);
+            EXPECT_EQ(response.inner.paths.size(), indices.size());
+            for (size_t i = 0; i < indices.size(); ++i) {
+                EXPECT_EQ(response.inner.paths[i], memdb.get_sibling_path(indices[i]));
+            }
+            signal.signal_level();
+        },
+        true);
+    signal.wait_for_level();
+
+    Signal committed_signal;
+    tree.get_sibling_paths(
+        { 7 },
+        [&](const TypedResponse<GetSiblingPathsResponse>& response) {
+            EXPECT_EQ(response.success, true);
+            EXPECT_EQ(response.inner.paths, std::vector<fr_sibling_path>{ committed_path });
+            committed_signal.signal_level();
+        },
+        false);
+    committed_signal.wait_for_level();
+}
+
 TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_create_images_at_historic_blocks)
 {
     constexpr size_t depth = 5;
@@ -8,6 +8,7 @@
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <span>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
@@ -17,17 +18,30 @@ struct PedersenHashPolicy {
 
     static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
 
+    // Computes parents[i] = hash_pair(children[2i], children[2i + 1])
+    static void hash_pairs(std::span<const fr> children, std::span<fr> parents)
+    {
+        for (size_t i = 0; i < parents.size(); ++i) {
+            parents[i] = hash_pair(children[i * 2], children[i * 2 + 1]);
+        }
+    }
+
     static fr zero_hash() { return fr::zero(); }
 };
 
 struct Poseidon2HashPolicy {
-    static fr hash(const std::vector<fr>& inputs)
+    using Poseidon2 = bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    static fr hash(const std::vector<fr>& inputs) { return Poseidon2::hash(inputs); }
+
+    static fr hash_pair(const fr& lhs, const fr& rhs) { return Poseidon2::hash_pair(lhs, rhs); }
+
+    // Computes parents[i] = hash_pair(children[2i], children[2i + 1])
+    static void hash_pairs(std::span<const fr> children, std::span<fr> parents)
     {
-        return bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash(inputs);
+        Poseidon2::hash_pairs(children, parents);
     }
 
-    static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
-
     static fr zero_hash() { return fr::zero(); }
 };
 
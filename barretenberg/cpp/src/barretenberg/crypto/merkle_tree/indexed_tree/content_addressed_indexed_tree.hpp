@@ -52,6 +52,7 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
     using AddCompletionCallback = std::function<void(const TypedResponse<AddDataResponse>&)>;
     using LeafCallback = std::function<void(const TypedResponse<GetIndexedLeafResponse<LeafValueType>>&)>;
     using FindLowLeafCallback = std::function<void(const TypedResponse<GetLowIndexedLeafResponse>&)>;
+    using FindLowLeavesCallback = std::function<void(const TypedResponse<GetLowIndexedLeavesResponse>&)>;
 
     ContentAddressedIndexedTree(std::unique_ptr<Store> store,
                                 std::shared_ptr<ThreadPool> workers,
@@ -62,6 +63,12 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
     ContentAddressedIndexedTree& operator=(const ContentAddressedIndexedTree& other) = delete;
     ContentAddressedIndexedTree& operator=(ContentAddressedIndexedTree&& other) = delete;
 
+    /**
+     * @brief Returns a tree on a snapshot of this fork's store (see ContentAddressedCachedTreeStore::create_snapshot)
+     * Synchronous, it neither reads from the persisted store nor computes any hashes.
+     */
+    std::unique_ptr<ContentAddressedIndexedTree> create_snapshot() const;
+
     /**
      * @brief Adds or updates a single values in the tree (updates not currently supported)
      */
@@ -163,6 +170,21 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
                        bool includeUncommitted,
                        const FindLowLeafCallback& on_completion) const;
 
+    /**
+     * @brief Find the leaves with the values immediately lower then each of the values provided, in one transaction
+     */
+    void find_low_leaves(const std::vector<fr>& leaf_keys,
+                         bool includeUncommitted,
+                         const FindLowLeavesCallback& on_completion) const;
+
+    /**
+     * @brief Find the leaves with the values immediately lower then each of the values provided, in one transaction
+     */
+    void find_low_leaves(const std::vector<fr>& leaf_keys,
+                         const index_t& blockNumber,
+                         bool includeUncommitted,
+                         const FindLowLeavesCallback& on_completion) const;
+
     using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_path;
 
   private:
@@ -170,6 +192,11 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
     using ReadTransaction = typename Store::ReadTransaction;
     using ReadTransactionPtr = typename Store::ReadTransactionPtr;
 
+    // Takes the tree's parameters and zero hashes from another tree of the same shape rather than computing them
+    ContentAddressedIndexedTree(std::unique_ptr<Store> store, const ContentAddressedIndexedTree& other)
+        : ContentAddressedAppendOnlyTree<Store, HashingPolicy>(std::move(store), other)
+    {}
+
     struct Status {
         std::atomic_bool success{ true };
         std::string message;
@@ -322,6 +349,14 @@ ContentAddressedIndexedTree<Store, HashingPolicy>::ContentAddressedIndexedTree(s
     store_->commit(false);
 }
 
+template <typename Store, typename HashingPolicy>
+std::unique_ptr<ContentAddressedIndexedTree<Store, HashingPolicy>> ContentAddressedIndexedTree<Store, HashingPolicy>::
+    create_snapshot() const
+{
+    return std::unique_ptr<ContentAddressedIndexedTree>(
+        new ContentAddressedIndexedTree(store_->create_snapshot(), *this));
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedIndexedTree<Store, HashingPolicy>::get_leaf(const index_t& index,
                                                                  bool includeUncommitted,
@@ -526,6 +561,63 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::find_low_leaf(const fr&
     workers_->enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+void ContentAddressedIndexedTree<Store, HashingPolicy>::find_low_leaves(
+    const std::vector<fr>& leaf_keys, bool includeUncommitted, const FindLowLeavesCallback& on_completion) const
+{
+    auto job = [=, this]() {
+        execute_and_report<GetLowIndexedLeavesResponse>(
+            [=, this](TypedResponse<GetLowIndexedLeavesResponse>& response) {
+                typename Store::ReadTransactionPtr tx = store_->create_read_transaction();
+                RequestContext requestContext;
+                requestContext.includeUncommitted = includeUncommitted;
+                requestContext.root = store_->get_current_root(*tx, includeUncommitted);
+                response.inner.low_leaves.reserve(leaf_keys.size());
+                for (const fr& leaf_key : leaf_keys) {
+                    std::pair<bool, index_t> result = store_->find_low_value(leaf_key, requestContext, *tx);
+                    response.inner.low_leaves.push_back({ result.first, result.second });
+                }
+            },
+            on_completion);
+    };
+
+    workers_->enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedIndexedTree<Store, HashingPolicy>::find_low_leaves(const std::vector<fr>& leaf_keys,
+                                                                        const index_t& blockNumber,
+                                                                        bool includeUncommitted,
+                                                                        const FindLowLeavesCallback& on_completion)
+    const
+{
+    auto job = [=, this]() {
+        execute_and_report<GetLowIndexedLeavesResponse>(
+            [=, this](TypedResponse<GetLowIndexedLeavesResponse>& response) {
+                if (blockNumber == 0) {
+                    throw std::runtime_error("Invalid block number");
+                }
+                typename Store::ReadTransactionPtr tx = store_->create_read_transaction();
+                BlockPayload blockData;
+                if (!store_->get_block_data(blockNumber, blockData, *tx)) {
+                    throw std::runtime_error("Data for block unavailable");
+                }
+                RequestContext requestContext;
+                requestContext.blockNumber = blockNumber;
+                requestContext.includeUncommitted = includeUncommitted;
+                requestContext.root = blockData.root;
+                response.inner.low_leaves.reserve(leaf_keys.size());
+                for (const fr& leaf_key : leaf_keys) {
+                    std::pair<bool, index_t> result = store_->find_low_value(leaf_key, requestContext, *tx);
+                    response.inner.low_leaves.push_back({ result.first, result.second });
+                }
+            },
+            on_completion);
+    };
+
+    workers_->enqueue(job);
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedIndexedTree<Store, HashingPolicy>::add_or_update_value(
     const LeafValueType& value, const AddCompletionCallbackWithWitness& completion)
@@ -1406,6 +1406,40 @@ TEST_F(PersistedContentAddressedIndexedTreeTest, returns_low_leaves)
     EXPECT_EQ(predecessor.index, 2);
 }
 
+TEST_F(PersistedContentAddressedIndexedTreeTest, returns_multiple_low_leaves)
+{
+    constexpr uint32_t depth = 8;
+
+    ThreadPoolPtr workers = make_thread_pool(1);
+    std::string name = random_string();
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    auto tree = TreeType(std::move(store), workers, 2);
+
+    add_value(tree, NullifierLeafValue(42));
+    commit_tree(tree);
+    add_value(tree, NullifierLeafValue(100));
+
+    std::vector<fr> keys = { 150, 42, 43, 100, 7 };
+    auto check_low_leaves = [&](bool includeUncommitted) {
+        TypedResponse<GetLowIndexedLeavesResponse> response;
+        Signal signal;
+        tree.find_low_leaves(keys, includeUncommitted, [&](const TypedResponse<GetLowIndexedLeavesResponse>& r) {
+            response = r;
+            signal.signal_level();
+        });
+        signal.wait_for_level();
+        EXPECT_EQ(response.success, true);
+        ASSERT_EQ(response.inner.low_leaves.size(), keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            GetLowIndexedLeafResponse expected = get_low_leaf(tree, NullifierLeafValue(keys[i]), includeUncommitted);
+            EXPECT_EQ(response.inner.low_leaves[i], expected);
+        }
+    };
+    check_low_leaves(true);
+    check_low_leaves(false);
+}
+
 TEST_F(PersistedContentAddressedIndexedTreeTest, duplicates)
 {
     // Create a depth-8 indexed merkle tree
@@ -8,6 +8,7 @@
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
 #include "lmdb_tree_store.hpp"
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -276,24 +277,98 @@ void LMDBTreeStore::delete_all_leaf_keys_before_or_equal_index(const index_t& in
     tx.delete_all_values_lesser_or_equal_key(key, *_leafIndexToKeyDatabase);
 }
 
+namespace {
+// The high nibble of the tag distinguishes the fixed layout from the msgpack maps written by earlier versions, which
+// start with a byte of 0x80 to 0x8f
+constexpr uint8_t NODE_PAYLOAD_TAG = 0x10;
+constexpr uint8_t NODE_PAYLOAD_TAG_MASK = 0xf0;
+constexpr uint8_t NODE_HAS_LEFT = 0x01;
+constexpr uint8_t NODE_HAS_RIGHT = 0x02;
+constexpr size_t NODE_CHILD_SIZE = 32;
+constexpr size_t NODE_REF_SIZE = sizeof(uint64_t);
+
+size_t encoded_node_payload_size(uint8_t tag)
+{
+    size_t num_children = ((tag & NODE_HAS_LEFT) != 0 ? 1 : 0) + ((tag & NODE_HAS_RIGHT) != 0 ? 1 : 0);
+    return 1 + num_children * NODE_CHILD_SIZE + NODE_REF_SIZE;
+}
+} // namespace
+
+void encode_node_payload(const NodePayload& payload, std::vector<uint8_t>& encoded)
+{
+    const auto tag = static_cast<uint8_t>(NODE_PAYLOAD_TAG | (payload.left.has_value() ? NODE_HAS_LEFT : 0) |
+                                          (payload.right.has_value() ? NODE_HAS_RIGHT : 0));
+    encoded.resize(encoded_node_payload_size(tag));
+    uint8_t* it = encoded.data();
+    *it++ = tag;
+    for (const auto& child : { payload.left, payload.right }) {
+        if (child.has_value()) {
+            fr::serialize_to_buffer(child.value(), it);
+            it += NODE_CHILD_SIZE;
+        }
+    }
+    serialize::write(it, payload.ref);
+}
+
+void decode_node_payload(const std::vector<uint8_t>& encoded, NodePayload& payload)
+{
+    if (encoded.empty()) {
+        throw std::runtime_error("Empty node payload");
+    }
+    const uint8_t tag = encoded[0];
+    if ((tag & NODE_PAYLOAD_TAG_MASK) != NODE_PAYLOAD_TAG) {
+        // Written by an earlier version
+        msgpack::unpack((const char*)encoded.data(), encoded.size()).get().convert(payload);
+        return;
+    }
+    if (encoded.size() != encoded_node_payload_size(tag)) {
+        throw std::runtime_error("Invalid node payload size");
+    }
+    const uint8_t* it = encoded.data() + 1;
+    for (auto [flag, child] : { std::make_pair(NODE_HAS_LEFT, &payload.left),
+                                std::make_pair(NODE_HAS_RIGHT, &payload.right) }) {
+        if ((tag & flag) != 0) {
+            *child = fr::serialize_from_buffer(it);
+            it += NODE_CHILD_SIZE;
+        } else {
+            child->reset();
+        }
+    }
+    serialize::read(it, payload.ref);
+}
+
 bool LMDBTreeStore::read_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx)
 {
     FrKeyType key(nodeHash);
     std::vector<uint8_t> data;
     bool success = tx.get_value<FrKeyType>(key, data, *_nodeDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
+        decode_node_payload(data, nodeData);
     }
     return success;
 }
 
 void LMDBTreeStore::write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, nodeData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    std::vector<uint8_t> encoded;
+    encode_node_payload(nodeData, encoded);
     FrKeyType key(nodeHash);
     tx.put_value<FrKeyType>(key, encoded, *_nodeDatabase);
 }
 
+void LMDBTreeStore::write_nodes(const std::vector<std::pair<fr, NodePayload>>& nodes, WriteTransaction& tx)
+{
+    std::vector<std::pair<FrKeyType, const NodePayload*>> sorted;
+    sorted.reserve(nodes.size());
+    for (const auto& [hash, payload] : nodes) {
+        sorted.emplace_back(FrKeyType(hash), &payload);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    std::vector<uint8_t> encoded;
+    for (auto& [key, payload] : sorted) {
+        encode_node_payload(*payload, encoded);
+        tx.put_value<FrKeyType>(key, encoded, *_nodeDatabase);
+    }
+}
+
 } // namespace bb::crypto::merkle_tree
\ No newline at end of file
@@ -18,6 +18,7 @@
 #include <typeinfo>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace bb::crypto::merkle_tree {
 
@@ -63,6 +64,14 @@ struct NodePayload {
     }
 };
 
+/**
+ * @brief Node payloads are stored in a fixed layout rather than as msgpack maps: a tag byte recording which children
+ * are present, each present child as a 32 byte field element and the reference count as a uint64, all big-endian.
+ * Nodes written as msgpack by earlier versions are still read, and are re-encoded whenever they are next written.
+ */
+void encode_node_payload(const NodePayload& payload, std::vector<uint8_t>& encoded);
+void decode_node_payload(const std::vector<uint8_t>& encoded, NodePayload& payload);
+
 struct DBStats {
     std::string name;
     uint64_t mapSize;
@@ -152,6 +161,13 @@ class LMDBTreeStore {
 
     void write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx);
 
+    /**
+     * @brief Writes the nodes in increasing order of key, so that consecutive puts land on neighbouring pages
+     */
+    void write_nodes(const std::vector<std::pair<fr, NodePayload>>& nodes, WriteTransaction& tx);
+
+    template <typename TxType> bool get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx);
+
     void increment_node_reference_count(const fr& nodeHash, WriteTransaction& tx);
 
     void set_or_increment_node_reference_count(const fr& nodeHash, NodePayload& nodeData, WriteTransaction& tx);
@@ -189,8 +205,6 @@ class LMDBTreeStore {
     LMDBDatabase::Ptr _leafValueToIndexDatabase;
     LMDBDatabase::Ptr _leafHashToPreImageDatabase;
     LMDBDatabase::Ptr _leafIndexToKeyDatabase;
-
-    template <typename TxType> bool get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx);
 };
 
 template <typename TxType> bool LMDBTreeStore::read_leaf_indices(const fr& leafValue, Indices& indices, TxType& tx)
@@ -232,7 +246,7 @@ template <typename TxType> bool LMDBTreeStore::get_node_data(const fr& nodeHash,
     std::vector<uint8_t> data;
     bool success = tx.template get_value<FrKeyType>(key, data, *_nodeDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
+        decode_node_payload(data, nodeData);
     }
     return success;
 }
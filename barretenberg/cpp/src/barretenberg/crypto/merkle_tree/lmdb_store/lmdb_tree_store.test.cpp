@@ -153,6 +153,68 @@ TEST_F(LMDBTreeStoreTest, can_write_and_read_nodes)
     }
 }
 
+TEST_F(LMDBTreeStoreTest, can_encode_and_decode_nodes)
+{
+    std::vector<NodePayload> payloads{
+        { .left = VALUES[0], .right = VALUES[1], .ref = 1 },
+        { .left = VALUES[2], .right = std::nullopt, .ref = 2 },
+        { .left = std::nullopt, .right = VALUES[3], .ref = 0xffffffffffffULL },
+        { .left = std::nullopt, .right = std::nullopt, .ref = 7 },
+    };
+    std::vector<size_t> expected_sizes{ 73, 41, 41, 9 };
+    for (size_t i = 0; i < payloads.size(); ++i) {
+        std::vector<uint8_t> encoded;
+        encode_node_payload(payloads[i], encoded);
+        EXPECT_EQ(encoded.size(), expected_sizes[i]);
+        NodePayload decoded{ .left = VALUES[9], .right = VALUES[9], .ref = 0 };
+        decode_node_payload(encoded, decoded);
+        EXPECT_EQ(decoded, payloads[i]);
+    }
+
+    std::vector<uint8_t> truncated;
+    encode_node_payload(payloads[0], truncated);
+    truncated.pop_back();
+    NodePayload decoded;
+    EXPECT_THROW(decode_node_payload(truncated, decoded), std::runtime_error);
+}
+
+TEST_F(LMDBTreeStoreTest, can_decode_msgpack_encoded_nodes)
+{
+    // Nodes were stored as msgpack by earlier versions
+    for (const NodePayload& payload : { NodePayload{ .left = VALUES[0], .right = VALUES[1], .ref = 3 },
+                                        NodePayload{ .left = std::nullopt, .right = std::nullopt, .ref = 1 } }) {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, payload);
+        std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+        NodePayload decoded;
+        decode_node_payload(encoded, decoded);
+        EXPECT_EQ(decoded, payload);
+    }
+}
+
+TEST_F(LMDBTreeStoreTest, can_write_nodes_in_batch)
+{
+    std::vector<std::pair<bb::fr, NodePayload>> nodes;
+    for (size_t i = 0; i < 8; ++i) {
+        nodes.emplace_back(VALUES[i], NodePayload{ .left = VALUES[i + 1], .right = VALUES[i + 2], .ref = i + 1 });
+    }
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+    {
+        LMDBTreeWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.write_nodes(nodes, *transaction);
+        transaction->commit();
+    }
+
+    {
+        LMDBTreeReadTransaction::Ptr transaction = store.create_read_transaction();
+        for (const auto& [key, payload] : nodes) {
+            NodePayload readBack;
+            EXPECT_TRUE(store.read_node(key, readBack, *transaction));
+            EXPECT_EQ(readBack, payload);
+        }
+    }
+}
+
 TEST_F(LMDBTreeStoreTest, can_write_and_read_leaves_by_hash)
 {
     PublicDataLeafValue leafData;
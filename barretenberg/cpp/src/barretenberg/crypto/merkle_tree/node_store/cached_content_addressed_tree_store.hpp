@@ -1,4 +1,5 @@
 #pragma once
+#include "./sharded_map.hpp"
 #include "./tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/callbacks.hpp"
@@ -10,6 +11,7 @@
 #include "barretenberg/serialize/msgpack.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include "msgpack/assert.hpp"
+#include <atomic>
 #include <cstdint>
 #include <exception>
 #include <memory>
@@ -19,17 +21,22 @@
 #include <stdexcept>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 template <> struct std::hash<uint256_t> {
-    std::size_t operator()(const uint256_t& k) const { return k.data[0]; }
-};
-template <> struct std::hash<bb::fr> {
-    std::size_t operator()(const bb::fr& k) const
+    std::size_t operator()(const uint256_t& k) const
     {
-        bb::numeric::uint256_t val(k);
-        return val.data[0];
+        // Fold in all of the limbs, the low one alone is a poor hash for keys that are not uniformly distributed
+        std::size_t hash = k.data[0];
+        for (size_t i = 1; i < 4; ++i) {
+            hash = (hash ^ (hash >> 32)) * 0x9e3779b97f4a7c15ULL + k.data[i];
+        }
+        return hash;
     }
 };
+template <> struct std::hash<bb::fr> {
+    std::size_t operator()(const bb::fr& k) const { return std::hash<uint256_t>()(bb::numeric::uint256_t(k)); }
+};
 
 namespace bb::crypto::merkle_tree {
 
@@ -55,7 +62,8 @@ template <> inline bool requires_preimage_for_key<fr>()
 
 /**
  * @brief Serves as a key-value node store for merkle trees. Caches all changes in memory before persisting them during
- * a 'commit' operation.
+ * a 'commit' operation. The caches are sharded maps, so that the threads inserting into a tree and those reading from
+ * it do not serialise on a single lock.
  * Manages the persisted store by seperating the key spaces as follows:
  * 1 byte key of 0: Tree meta data
  * 8 byte integers: The index of each leaf to the value of that leaf
@@ -85,6 +93,12 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
     ContentAddressedCachedTreeStore& operator=(ContentAddressedCachedTreeStore const& other) = delete;
     ContentAddressedCachedTreeStore& operator=(ContentAddressedCachedTreeStore const&& other) = delete;
 
+    /**
+     * @brief Returns a new store on the same block as this fork. It starts with none of this store's uncommitted data
+     * and is created without reading from the persisted store.
+     */
+    std::unique_ptr<ContentAddressedCachedTreeStore> create_snapshot() const;
+
     /**
      * @brief Returns the index of the leaf with a value immediately lower than the value provided
      */
@@ -209,26 +223,65 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
     uint32_t depth_;
     std::optional<BlockPayload> initialised_from_block_;
 
-    // This is a mapping between the node hash and it's payload (children and ref count) for every node in the tree,
-    // including leaves. As indexed trees are updated, this will end up containing many nodes that are not part of the
-    // final tree so they need to be omitted from what is committed.
-    std::unordered_map<fr, NodePayload> nodes_;
-
-    // This is a store mapping the leaf key (e.g. slot for public data or nullifier value for nullifier tree) to the
-    // indices in the tree For indexed tress there is only ever one index against the key, for append-only trees there
-    // can be multiple
-    std::map<uint256_t, Indices> indices_;
-
-    // This is a mapping from leaf hash to leaf pre-image. This will contain entries that need to be omitted when
-    // commiting updates
-    std::unordered_map<fr, IndexedLeafValueType> leaves_;
     PersistedStoreType::SharedPtr dataStore_;
     TreeMeta meta_;
+    // Protects meta_, the caches are synchronised internally
     mutable std::mutex mtx_;
 
-    // The following stores are not persisted, just cached until commit
-    std::vector<std::unordered_map<index_t, fr>> nodes_by_index_;
-    std::unordered_map<index_t, IndexedLeafValueType> leaf_pre_image_by_index_;
+    struct NodeIndex {
+        uint32_t level;
+        index_t index;
+        bool operator==(const NodeIndex& other) const = default;
+    };
+    struct NodeIndexHash {
+        std::size_t operator()(const NodeIndex& node) const
+        {
+            return std::hash<index_t>()(node.index) ^ (static_cast<std::size_t>(node.level) << 57);
+        }
+    };
+
+    struct UncommittedCaches {
+        // This is a mapping between the node hash and it's payload (children and ref count) for every node in the
+        // tree, including leaves. As indexed trees are updated, this will end up containing many nodes that are not
+        // part of the final tree so they need to be omitted from what is committed.
+        ShardedHashMap<fr, NodePayload> nodes;
+
+        // This is a store mapping the leaf key (e.g. slot for public data or nullifier value for nullifier tree) to
+        // the indices in the tree For indexed tress there is only ever one index against the key, for append-only
+        // trees there can be multiple
+        ShardedOrderedMap<Indices> indices;
+
+        // This is a mapping from leaf hash to leaf pre-image. This will contain entries that need to be omitted when
+        // commiting updates
+        ShardedHashMap<fr, IndexedLeafValueType> leaves;
+
+        // The following stores are not persisted, just cached until commit
+        ShardedHashMap<NodeIndex, fr, NodeIndexHash> nodes_by_index;
+        ShardedHashMap<index_t, IndexedLeafValueType> leaf_pre_image_by_index;
+
+        void clear()
+        {
+            nodes.clear();
+            indices.clear();
+            leaves.clear();
+            nodes_by_index.clear();
+            leaf_pre_image_by_index.clear();
+        }
+    };
+
+    // The caches are only allocated when the store is first written to, so a store that is only read from, such as an
+    // idle fork, costs little more than its meta data. Readers use them without taking caches_mtx_, so once allocated
+    // they live as long as the store: rollback empties them in place, under their shard locks, rather than freeing them
+    std::unique_ptr<UncommittedCaches> caches_owner_;
+    std::atomic<UncommittedCaches*> caches_{ nullptr };
+    mutable std::mutex caches_mtx_;
+
+    const UncommittedCaches* caches() const { return caches_.load(std::memory_order_acquire); }
+
+    UncommittedCaches& mutable_caches();
+
+    // Used by create_snapshot()
+    ContentAddressedCachedTreeStore(const ContentAddressedCachedTreeStore& fork, const BlockPayload& block);
 
     void initialise();
 
@@ -248,6 +301,9 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     void persist_leaf_pre_image(const fr& hash, WriteTransaction& tx);
 
+    /**
+     * @brief Adds a reference to the node and persists the uncommitted sub-tree underneath it, walking it iteratively
+     */
     void persist_node(const std::optional<fr>& optional_hash, uint32_t level, WriteTransaction& tx);
 
     void remove_node(const std::optional<fr>& optional_hash,
@@ -273,7 +329,6 @@ ContentAddressedCachedTreeStore<LeafValueType>::ContentAddressedCachedTreeStore(
     : name_(std::move(name))
     , depth_(levels)
     , dataStore_(dataStore)
-    , nodes_by_index_(std::vector<std::unordered_map<index_t, fr>>(depth_ + 1, std::unordered_map<index_t, fr>()))
 {
     initialise();
 }
@@ -286,11 +341,36 @@ ContentAddressedCachedTreeStore<LeafValueType>::ContentAddressedCachedTreeStore(
     : name_(std::move(name))
     , depth_(levels)
     , dataStore_(dataStore)
-    , nodes_by_index_(std::vector<std::unordered_map<index_t, fr>>(depth_ + 1, std::unordered_map<index_t, fr>()))
 {
     initialise_from_block(referenceBlockNumber);
 }
 
+template <typename LeafValueType>
+ContentAddressedCachedTreeStore<LeafValueType>::ContentAddressedCachedTreeStore(
+    const ContentAddressedCachedTreeStore& fork, const BlockPayload& block)
+    : name_(fork.name_)
+    , depth_(fork.depth_)
+    , initialised_from_block_(block)
+    , dataStore_(fork.dataStore_)
+{
+    std::unique_lock lock(fork.mtx_);
+    meta_ = fork.meta_;
+    // Discard any changes made to the fork's meta data since it was created
+    enrich_meta_from_block(meta_);
+}
+
+template <typename LeafValueType>
+std::unique_ptr<ContentAddressedCachedTreeStore<LeafValueType>> ContentAddressedCachedTreeStore<
+    LeafValueType>::create_snapshot() const
+{
+    if (!initialised_from_block_.has_value()) {
+        throw std::runtime_error("Only forks can be snapshotted");
+    }
+    // The constructor is private, so std::make_unique can't be used
+    return std::unique_ptr<ContentAddressedCachedTreeStore>(
+        new ContentAddressedCachedTreeStore(*this, initialised_from_block_.value()));
+}
+
 template <typename LeafValueType>
 index_t ContentAddressedCachedTreeStore<LeafValueType>::constrain_tree_size(const RequestContext& requestContext,
                                                                             ReadTransaction& tx) const
@@ -322,38 +402,25 @@ std::pair<bool, index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_lo
     auto db_index = committed.indices[0];
     uint256_t retrieved_value = found_key;
 
-    // Accessing indices_ from here under a lock
-    std::unique_lock lock(mtx_);
-    if (!requestContext.includeUncommitted || retrieved_value == new_value_as_number || indices_.empty()) {
+    if (!requestContext.includeUncommitted || retrieved_value == new_value_as_number) {
         return std::make_pair(new_value_as_number == retrieved_value, db_index);
     }
 
     // At this stage, we have been asked to include uncommitted and the value was not exactly found in the db
-    auto it = indices_.lower_bound(new_value_as_number);
-    if (it == indices_.end()) {
-        // there is no element >= the requested value.
-        // decrement the iterator to get the value preceeding the requested value
-        --it;
-        // we need to return the larger of the db value or the cached value
-
-        return std::make_pair(false, it->first > retrieved_value ? it->second.indices[0] : db_index);
-    }
-
-    if (it->first == uint256_t(new_value_as_number)) {
-        // the value is already present and the iterator points to it
-        return std::make_pair(true, it->second.indices[0]);
-    }
-    // the iterator points to the element immediately larger than the requested value
-    // We need to return the highest value from
-    // 1. The next lowest cached value, if there is one
-    // 2. The value retrieved from the db
-    if (it == indices_.begin()) {
-        // No cached lower value, return the db index
+    // Find the greatest cached value <= the requested value
+    const UncommittedCaches* caches = this->caches();
+    auto floor = caches != nullptr ? caches->indices.find_floor(new_value_as_number) : std::nullopt;
+    if (!floor.has_value()) {
+        // No cached value that is not larger, return the db index
         return std::make_pair(false, db_index);
     }
-    --it;
-    //  it now points to the value less than that requested
-    return std::make_pair(false, it->first > retrieved_value ? it->second.indices[0] : db_index);
+    const auto& [cached_value, cached_indices] = floor.value();
+    if (cached_value == new_value_as_number) {
+        // the value is already present
+        return std::make_pair(true, cached_indices.indices[0]);
+    }
+    // cached_value is the next lowest cached value, we need to return the larger of the db value or the cached value
+    return std::make_pair(false, cached_value > retrieved_value ? cached_indices.indices[0] : db_index);
 }
 
 template <typename LeafValueType>
@@ -363,16 +430,12 @@ ContentAddressedCachedTreeStore<LeafValueType>::get_leaf_by_hash(const fr& leaf_
                                                                  bool includeUncommitted) const
 {
     std::optional<typename ContentAddressedCachedTreeStore<LeafValueType>::IndexedLeafValueType> leaf = std::nullopt;
-    if (includeUncommitted) {
-        // Accessing leaves_ here under a lock
-        std::unique_lock lock(mtx_);
-        typename std::unordered_map<fr, IndexedLeafValueType>::const_iterator it = leaves_.find(leaf_hash);
-        if (it != leaves_.end()) {
-            leaf = it->second;
-            return leaf;
-        }
-    }
     IndexedLeafValueType leafData;
+    const UncommittedCaches* caches = this->caches();
+    if (includeUncommitted && caches != nullptr && caches->leaves.get(leaf_hash, leafData)) {
+        leaf = leafData;
+        return leaf;
+    }
     bool success = dataStore_->read_leaf_by_hash(leaf_hash, leafData, tx);
     if (success) {
         leaf = leafData;
@@ -384,31 +447,25 @@ template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::put_leaf_by_hash(const fr& leaf_hash,
                                                                       const IndexedLeafValueType& leafPreImage)
 {
-    // Accessing leaves_ under a lock
-    std::unique_lock lock(mtx_);
-    leaves_[leaf_hash] = leafPreImage;
+    mutable_caches().leaves.put(leaf_hash, leafPreImage);
 }
 
 template <typename LeafValueType>
 std::optional<typename ContentAddressedCachedTreeStore<LeafValueType>::IndexedLeafValueType>
 ContentAddressedCachedTreeStore<LeafValueType>::get_cached_leaf_by_index(const index_t& index) const
 {
-    // Accessing leaf_pre_image_by_index_ under a lock
-    std::unique_lock lock(mtx_);
-    auto it = leaf_pre_image_by_index_.find(index);
-    if (it == leaf_pre_image_by_index_.end()) {
+    const UncommittedCaches* caches = this->caches();
+    if (caches == nullptr) {
         return std::nullopt;
     }
-    return it->second;
+    return caches->leaf_pre_image_by_index.get(index);
 }
 
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::put_cached_leaf_by_index(const index_t& index,
                                                                               const IndexedLeafValueType& leafPreImage)
 {
-    // Accessing leaf_pre_image_by_index_ under a lock
-    std::unique_lock lock(mtx_);
-    leaf_pre_image_by_index_[index] = leafPreImage;
+    mutable_caches().leaf_pre_image_by_index.put(index, leafPreImage);
 }
 
 template <typename LeafValueType>
@@ -423,16 +480,7 @@ template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::update_index(const index_t& index, const fr& leaf)
 {
     // std::cout << "update_index at index " << index << " leaf " << leaf << std::endl;
-    //  Accessing indices_ under a lock
-    std::unique_lock lock(mtx_);
-    auto it = indices_.find(uint256_t(leaf));
-    if (it == indices_.end()) {
-        Indices ind;
-        ind.indices.push_back(index);
-        indices_[uint256_t(leaf)] = ind;
-        return;
-    }
-    it->second.indices.push_back(index);
+    mutable_caches().indices.update(uint256_t(leaf), [&](Indices& ind) { ind.indices.push_back(index); });
 }
 
 template <typename LeafValueType>
@@ -473,21 +521,18 @@ std::optional<index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_leaf
             }
         }
     }
-    if (includeUncommitted) {
-        // Accessing indices_ under a lock
-        std::unique_lock lock(mtx_);
-        auto it = indices_.find(uint256_t(leaf));
-        if (it != indices_.end() && !it->second.indices.empty()) {
-            for (index_t ind : it->second.indices) {
-                if (ind < start_index) {
-                    continue;
-                }
-                if (!result.has_value()) {
-                    result = ind;
-                    continue;
-                }
-                result = std::min(ind, result.value());
+    Indices uncommitted;
+    const UncommittedCaches* caches = this->caches();
+    if (includeUncommitted && caches != nullptr && caches->indices.get(uint256_t(leaf), uncommitted)) {
+        for (index_t ind : uncommitted.indices) {
+            if (ind < start_index) {
+                continue;
             }
+            if (!result.has_value()) {
+                result = ind;
+                continue;
+            }
+            result = std::min(ind, result.value());
         }
     }
     return result;
@@ -496,9 +541,7 @@ std::optional<index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_leaf
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::put_node_by_hash(const fr& nodeHash, const NodePayload& payload)
 {
-    // Accessing nodes_ under a lock
-    std::unique_lock lock(mtx_);
-    nodes_[nodeHash] = payload;
+    mutable_caches().nodes.put(nodeHash, payload);
 }
 
 template <typename LeafValueType>
@@ -507,14 +550,9 @@ bool ContentAddressedCachedTreeStore<LeafValueType>::get_node_by_hash(const fr&
                                                                       ReadTransaction& transaction,
                                                                       bool includeUncommitted) const
 {
-    if (includeUncommitted) {
-        // Accessing nodes_ under a lock
-        std::unique_lock lock(mtx_);
-        auto it = nodes_.find(nodeHash);
-        if (it != nodes_.end()) {
-            payload = it->second;
-            return true;
-        }
+    const UncommittedCaches* caches = this->caches();
+    if (includeUncommitted && caches != nullptr && caches->nodes.get(nodeHash, payload)) {
+        return true;
     }
     return dataStore_->read_node(nodeHash, payload, transaction);
 }
@@ -525,17 +563,12 @@ void ContentAddressedCachedTreeStore<LeafValueType>::put_cached_node_by_index(ui
                                                                               const fr& data,
                                                                               bool overwriteIfPresent)
 {
-    // Accessing nodes_by_index_ under a lock
-    std::unique_lock lock(mtx_);
+    UncommittedCaches& caches = mutable_caches();
     if (!overwriteIfPresent) {
-        const auto& level_map = nodes_by_index_[level];
-        auto it = level_map.find(index);
-        if (it != level_map.end()) {
-            return;
-        }
+        caches.nodes_by_index.put_if_absent({ level, index }, data);
+        return;
     }
-
-    nodes_by_index_[level][index] = data;
+    caches.nodes_by_index.put({ level, index }, data);
 }
 
 template <typename LeafValueType>
@@ -543,15 +576,8 @@ bool ContentAddressedCachedTreeStore<LeafValueType>::get_cached_node_by_index(ui
                                                                               index_t index,
                                                                               fr& data) const
 {
-    // Accessing nodes_by_index_ under a lock
-    std::unique_lock lock(mtx_);
-    const auto& level_map = nodes_by_index_[level];
-    auto it = level_map.find(index);
-    if (it == level_map.end()) {
-        return false;
-    }
-    data = it->second;
-    return true;
+    const UncommittedCaches* caches = this->caches();
+    return caches != nullptr && caches->nodes_by_index.get({ level, index }, data);
 }
 
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::put_meta(const TreeMeta& m)
@@ -642,8 +668,7 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
         if (!metaToCommit) {
             return;
         }
-        auto currentRootIter = nodes_.find(uncommittedMeta.root);
-        dataPresent = currentRootIter != nodes_.end();
+        dataPresent = caches() != nullptr && caches()->nodes.contains(uncommittedMeta.root);
         if (!dataPresent) {
             // no uncommitted data present, if we were asked to commit as a block then we can't
             if (asBlock) {
@@ -683,45 +708,45 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
         }
     }
 
-    // rolling back destroys all cache stores and also refreshes the cached meta_ from persisted state
+    // rolling back empties all cache stores and also refreshes the cached meta_ from persisted state
     rollback();
 }
 
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::persist_leaf_indices(WriteTransaction& tx)
 {
-    for (auto& idx : indices_) {
-        FrKeyType key = idx.first;
-        dataStore_->write_leaf_indices(key, idx.second, tx);
-    }
+    caches()->indices.for_each([&](const uint256_t& leaf, const Indices& indices) {
+        FrKeyType key = leaf;
+        dataStore_->write_leaf_indices(key, indices, tx);
+    });
 }
 
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::persist_leaf_keys(index_t startIndex, WriteTransaction& tx)
 {
-    for (auto& idx : indices_) {
-        FrKeyType key = idx.first;
+    caches()->indices.for_each([&](const uint256_t& leaf, const Indices& indices) {
+        FrKeyType key = leaf;
 
         // write the leaf key against the indices, this is for the pending chain store of indices
-        for (index_t indexForKey : idx.second.indices) {
+        for (index_t indexForKey : indices.indices) {
             if (indexForKey < startIndex) {
                 continue;
             }
             dataStore_->write_leaf_key_by_index(key, indexForKey, tx);
         }
-    }
+    });
 }
 
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::persist_leaf_pre_image(const fr& hash, WriteTransaction& tx)
 {
     // Now persist the leaf pre-image
-    auto leafPreImageIter = leaves_.find(hash);
-    if (leafPreImageIter == leaves_.end()) {
+    IndexedLeafValueType leafPreImage;
+    if (!caches()->leaves.get(hash, leafPreImage)) {
         return;
     }
-    // std::cout << "Persisting leaf preimage " << leafPreImageIter->second << std::endl;
-    dataStore_->write_leaf_by_hash(hash, leafPreImageIter->second, tx);
+    // std::cout << "Persisting leaf preimage " << leafPreImage << std::endl;
+    dataStore_->write_leaf_by_hash(hash, leafPreImage, tx);
 }
 
 template <typename LeafValueType>
@@ -729,65 +754,100 @@ void ContentAddressedCachedTreeStore<LeafValueType>::persist_node(const std::opt
                                                                   uint32_t level,
                                                                   WriteTransaction& tx)
 {
+    // The dirty sub-tree is walked one level at a time. Every visit to a node adds a reference to it.
     // If the optional hash does not have a value then it means it's the zero tree value at this level
     // If it has a value but that value is not in our stores then it means it is referencing a node
     // created in a previous block, so that will need to have it's reference count increased
-    if (!optional_hash.has_value()) {
-        return;
-    }
-    fr hash = optional_hash.value();
-
-    if (level == depth_) {
-        // this is a leaf
-        persist_leaf_pre_image(hash, tx);
+    // The updated nodes are gathered and written in key order once the walk is done
+    std::vector<std::pair<fr, NodePayload>> updated;
+    std::unordered_map<fr, size_t> updated_positions;
+    std::vector<fr> current_level;
+    std::vector<fr> next_level;
+    if (optional_hash.has_value()) {
+        current_level.push_back(optional_hash.value());
     }
+    for (; !current_level.empty(); ++level) {
+        next_level.clear();
+        for (const fr& hash : current_level) {
+            if (level == depth_) {
+                // this is a leaf
+                persist_leaf_pre_image(hash, tx);
+            }
 
-    // std::cout << "Persisting node hash " << hash << " at level " << level << std::endl;
+            auto position = updated_positions.find(hash);
+            if (position != updated_positions.end()) {
+                // Already visited in this walk, so the sub-tree underneath has been dealt with
+                ++updated[position->second].second.ref;
+                continue;
+            }
 
-    auto nodePayloadIter = nodes_.find(hash);
-    if (nodePayloadIter == nodes_.end()) {
-        //  need to increase the stored node's reference count here
-        dataStore_->increment_node_reference_count(hash, tx);
-        return;
-    }
-    NodePayload nodeData = nodePayloadIter->second;
-    dataStore_->set_or_increment_node_reference_count(hash, nodeData, tx);
-    if (nodeData.ref != 1) {
-        // If the node now has a ref count greater then 1, we don't continue.
-        // It means that the entire sub-tree underneath already exists
-        return;
+            NodePayload nodeData;
+            const bool cached = caches()->nodes.get(hash, nodeData);
+            // Set to zero here and enrich from DB if present
+            nodeData.ref = 0;
+            if (!dataStore_->get_node_data(hash, nodeData, tx) && !cached) {
+                throw std::runtime_error("Failed to find node when attempting to increases reference count");
+            }
+            ++nodeData.ref;
+            updated_positions.emplace(hash, updated.size());
+            updated.emplace_back(hash, nodeData);
+            // If the node now has a ref count greater then 1, we don't continue.
+            // It means that the entire sub-tree underneath already exists
+            if (!cached || nodeData.ref != 1) {
+                continue;
+            }
+            for (const auto& child : { nodeData.left, nodeData.right }) {
+                if (child.has_value()) {
+                    next_level.push_back(child.value());
+                }
+            }
+        }
+        std::swap(current_level, next_level);
     }
-    persist_node(nodePayloadIter->second.left, level + 1, tx);
-    persist_node(nodePayloadIter->second.right, level + 1, tx);
+    dataStore_->write_nodes(updated, tx);
 }
 
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::hydrate_indices_from_persisted_store(ReadTransaction& tx)
 {
-    for (auto& idx : indices_) {
-        std::vector<uint8_t> value;
-        FrKeyType key = idx.first;
+    mutable_caches().indices.for_each([&](const uint256_t& leaf, Indices& indices) {
+        FrKeyType key = leaf;
         Indices persistedIndices;
         bool success = dataStore_->read_leaf_indices(key, persistedIndices, tx);
         if (success) {
-            idx.second.indices.insert(
-                idx.second.indices.begin(), persistedIndices.indices.begin(), persistedIndices.indices.end());
+            indices.indices.insert(
+                indices.indices.begin(), persistedIndices.indices.begin(), persistedIndices.indices.end());
         }
-    }
+    });
 }
 
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::rollback()
 {
-    // Extract the committed meta data and destroy the cache
+    // Extract the committed meta data and empty the cache
     {
         ReadTransactionPtr tx = create_read_transaction();
         read_persisted_meta(meta_, *tx);
     }
-    nodes_ = std::unordered_map<fr, NodePayload>();
-    indices_ = std::map<uint256_t, Indices>();
-    leaves_ = std::unordered_map<fr, IndexedLeafValueType>();
-    nodes_by_index_ = std::vector<std::unordered_map<index_t, fr>>(depth_ + 1, std::unordered_map<index_t, fr>());
-    leaf_pre_image_by_index_ = std::unordered_map<index_t, IndexedLeafValueType>();
+    std::unique_lock lock(caches_mtx_);
+    if (caches_owner_ != nullptr) {
+        caches_owner_->clear();
+    }
+}
+
+template <typename LeafValueType>
+typename ContentAddressedCachedTreeStore<LeafValueType>::UncommittedCaches& ContentAddressedCachedTreeStore<
+    LeafValueType>::mutable_caches()
+{
+    UncommittedCaches* caches = caches_.load(std::memory_order_acquire);
+    if (caches != nullptr) {
+        return *caches;
+    }
+    std::unique_lock lock(caches_mtx_);
+    if (caches_owner_ == nullptr) {
+        caches_owner_ = std::make_unique<UncommittedCaches>();
+        caches_.store(caches_owner_.get(), std::memory_order_release);
+    }
+    return *caches_owner_;
 }
 
 template <typename LeafValueType>
@@ -0,0 +1,251 @@
+#pragma once
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A hash map split into shards that are locked independently, so that threads accessing different keys rarely
+ * contend. Readers of a shard share its lock.
+ *
+ * @details The iteration and clearing methods are meant for when no other thread is accessing the map, e.g. while a
+ * tree store is committing. They lock each shard in turn and so do not see a consistent snapshot otherwise.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>, size_t NumShards = 32> class ShardedHashMap {
+    static_assert((NumShards & (NumShards - 1)) == 0, "The number of shards must be a power of two");
+
+  public:
+    void put(const Key& key, const Value& value)
+    {
+        Shard& shard = get_shard(key);
+        std::unique_lock lock(shard.mutex);
+        shard.map[key] = value;
+    }
+
+    /**
+     * @brief Insert the value unless the key is already present
+     * @return whether the value was inserted
+     */
+    bool put_if_absent(const Key& key, const Value& value)
+    {
+        Shard& shard = get_shard(key);
+        std::unique_lock lock(shard.mutex);
+        return shard.map.try_emplace(key, value).second;
+    }
+
+    bool get(const Key& key, Value& value) const
+    {
+        const Shard& shard = get_shard(key);
+        std::shared_lock lock(shard.mutex);
+        auto it = shard.map.find(key);
+        if (it == shard.map.end()) {
+            return false;
+        }
+        value = it->second;
+        return true;
+    }
+
+    std::optional<Value> get(const Key& key) const
+    {
+        Value value;
+        if (!get(key, value)) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    bool contains(const Key& key) const
+    {
+        const Shard& shard = get_shard(key);
+        std::shared_lock lock(shard.mutex);
+        return shard.map.contains(key);
+    }
+
+    /**
+     * @brief Apply f to every entry, in no particular order
+     */
+    template <typename Func> void for_each(Func&& f) const
+    {
+        for (const Shard& shard : shards_) {
+            std::shared_lock lock(shard.mutex);
+            for (const auto& [key, value] : shard.map) {
+                f(key, value);
+            }
+        }
+    }
+
+    size_t size() const
+    {
+        size_t total = 0;
+        for (const Shard& shard : shards_) {
+            std::shared_lock lock(shard.mutex);
+            total += shard.map.size();
+        }
+        return total;
+    }
+
+    void clear()
+    {
+        for (Shard& shard : shards_) {
+            std::unique_lock lock(shard.mutex);
+            std::unordered_map<Key, Value, Hash>().swap(shard.map);
+        }
+    }
+
+  private:
+    // Each shard on its own cache line(s), so that locking one does not invalidate its neighbours
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<Key, Value, Hash> map;
+    };
+
+    static size_t get_shard_index(const Key& key)
+    {
+        // The shard is picked from the top bits of a multiplicative hash, which are independent of the low bits that
+        // pick the bucket within the shard
+        constexpr size_t SHARD_BITS = std::countr_zero(NumShards);
+        if constexpr (SHARD_BITS == 0) {
+            return 0;
+        } else {
+            return static_cast<size_t>((static_cast<uint64_t>(Hash()(key)) * 0x9e3779b97f4a7c15ULL) >>
+                                       (64 - SHARD_BITS));
+        }
+    }
+    Shard& get_shard(const Key& key) { return shards_[get_shard_index(key)]; }
+    const Shard& get_shard(const Key& key) const { return shards_[get_shard_index(key)]; }
+
+    std::array<Shard, NumShards> shards_;
+};
+
+/**
+ * @brief An ordered map keyed by field elements, split by key range into shards that are locked independently
+ *
+ * @details The shard of a key is given by its top bits. Field elements are less than 2^254, so those are the bits below
+ * the top two of a uint256_t. Keys derived from hashes are spread evenly across the shards, and an ordered query only
+ * has to look beyond the shard of its key when that shard has nothing on the requested side of it.
+ *
+ * As with ShardedHashMap, iteration is meant for when no other thread is accessing the map.
+ */
+template <typename Value, size_t ShardBits = 5> class ShardedOrderedMap {
+  public:
+    static constexpr size_t NUM_SHARDS = 1UL << ShardBits;
+
+    /**
+     * @brief Apply f to the value for the key, default constructing it first if the key is absent
+     */
+    template <typename Func> void update(const uint256_t& key, Func&& f)
+    {
+        Shard& shard = shards_[get_shard_index(key)];
+        std::unique_lock lock(shard.mutex);
+        f(shard.map[key]);
+    }
+
+    bool get(const uint256_t& key, Value& value) const
+    {
+        const Shard& shard = shards_[get_shard_index(key)];
+        std::shared_lock lock(shard.mutex);
+        auto it = shard.map.find(key);
+        if (it == shard.map.end()) {
+            return false;
+        }
+        value = it->second;
+        return true;
+    }
+
+    /**
+     * @brief Returns the entry with the greatest key less than or equal to the given one, if there is one
+     */
+    std::optional<std::pair<uint256_t, Value>> find_floor(const uint256_t& key) const
+    {
+        size_t shard_index = get_shard_index(key);
+        {
+            const Shard& shard = shards_[shard_index];
+            std::shared_lock lock(shard.mutex);
+            auto it = shard.map.upper_bound(key);
+            if (it != shard.map.begin()) {
+                --it;
+                return *it;
+            }
+        }
+        // Nothing at or below the key in its own shard, so the floor is the greatest key of the closest non-empty shard
+        // below
+        while (shard_index-- > 0) {
+            const Shard& shard = shards_[shard_index];
+            std::shared_lock lock(shard.mutex);
+            if (!shard.map.empty()) {
+                return *shard.map.rbegin();
+            }
+        }
+        return std::nullopt;
+    }
+
+    bool empty() const
+    {
+        for (const Shard& shard : shards_) {
+            std::shared_lock lock(shard.mutex);
+            if (!shard.map.empty()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Apply f to every entry, in increasing order of key
+     */
+    template <typename Func> void for_each(Func&& f)
+    {
+        for (Shard& shard : shards_) {
+            std::unique_lock lock(shard.mutex);
+            for (auto& [key, value] : shard.map) {
+                f(key, value);
+            }
+        }
+    }
+
+    template <typename Func> void for_each(Func&& f) const
+    {
+        for (const Shard& shard : shards_) {
+            std::shared_lock lock(shard.mutex);
+            for (const auto& [key, value] : shard.map) {
+                f(key, value);
+            }
+        }
+    }
+
+    void clear()
+    {
+        for (Shard& shard : shards_) {
+            std::unique_lock lock(shard.mutex);
+            shard.map.clear();
+        }
+    }
+
+  private:
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        std::map<uint256_t, Value> map;
+    };
+
+    static size_t get_shard_index(const uint256_t& key)
+    {
+        // Keys of 2^254 and above, which are not field elements, all go to the last shard, preserving the order
+        constexpr uint64_t TOP_BIT_OFFSET = 62 - ShardBits;
+        return static_cast<size_t>(std::min(key.data[3] >> TOP_BIT_OFFSET, static_cast<uint64_t>(NUM_SHARDS - 1)));
+    }
+
+    std::array<Shard, NUM_SHARDS> shards_;
+};
+
+} // namespace bb::crypto::merkle_tree
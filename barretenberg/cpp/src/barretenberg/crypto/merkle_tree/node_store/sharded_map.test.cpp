@@ -0,0 +1,149 @@
+#include "barretenberg/crypto/merkle_tree/node_store/sharded_map.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+#include <gtest/gtest.h>
+#include <map>
+#include <thread>
+#include <vector>
+
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+auto& engine = bb::numeric::get_debug_randomness();
+
+// A random key below the bn254 modulus, i.e. below 2^254
+uint256_t random_key()
+{
+    uint256_t key = engine.get_random_uint256();
+    key.data[3] &= (1ULL << 62) - 1;
+    return key;
+}
+} // namespace
+
+TEST(ShardedMapTest, HashMapPutAndGet)
+{
+    ShardedHashMap<uint64_t, uint64_t> map;
+    for (uint64_t i = 0; i < 1000; ++i) {
+        map.put(i, i * 2);
+    }
+    EXPECT_EQ(map.size(), 1000UL);
+    EXPECT_EQ(map.get(500), 1000UL);
+    EXPECT_FALSE(map.get(1000).has_value());
+
+    EXPECT_FALSE(map.put_if_absent(500, 1));
+    EXPECT_EQ(map.get(500), 1000UL);
+    EXPECT_TRUE(map.put_if_absent(1000, 1));
+    EXPECT_EQ(map.get(1000), 1UL);
+    map.put(500, 1);
+    EXPECT_EQ(map.get(500), 1UL);
+
+    uint64_t sum = 0;
+    map.for_each([&](const uint64_t& key, const uint64_t&) { sum += key; });
+    EXPECT_EQ(sum, 1000UL * 1001 / 2);
+
+    map.clear();
+    EXPECT_EQ(map.size(), 0UL);
+    EXPECT_FALSE(map.contains(1));
+}
+
+TEST(ShardedMapTest, HashMapConcurrentAccess)
+{
+    ShardedHashMap<uint64_t, uint64_t> map;
+    constexpr uint64_t num_threads = 8;
+    constexpr uint64_t num_keys = 10000;
+    std::vector<std::thread> threads;
+    for (uint64_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (uint64_t i = t; i < num_keys; i += num_threads) {
+                map.put(i, i + 1);
+                // Read back keys written by this and other threads
+                uint64_t value = 0;
+                EXPECT_TRUE(map.get(i, value));
+                EXPECT_EQ(value, i + 1);
+                if (map.get(i / 2, value)) {
+                    EXPECT_EQ(value, i / 2 + 1);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(map.size(), num_keys);
+}
+
+TEST(ShardedMapTest, OrderedMapMatchesStdMap)
+{
+    ShardedOrderedMap<uint64_t> map;
+    std::map<uint256_t, uint64_t> expected;
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.find_floor(random_key()).has_value());
+
+    for (uint64_t i = 0; i < 200; ++i) {
+        uint256_t key = random_key();
+        map.update(key, [&](uint64_t& value) { value = i; });
+        expected[key] = i;
+    }
+    EXPECT_FALSE(map.empty());
+
+    // Ordered iteration
+    std::vector<uint256_t> keys;
+    map.for_each([&](const uint256_t& key, const uint64_t&) { keys.push_back(key); });
+    ASSERT_EQ(keys.size(), expected.size());
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+
+    // Floor queries for absent keys, present keys and the extremes of the key space
+    std::vector<uint256_t> queries = { 0, uint256_t(1) << 253, (uint256_t(1) << 254) - 1 };
+    for (size_t i = 0; i < 500; ++i) {
+        queries.push_back(random_key());
+    }
+    for (const auto& [key, value] : expected) {
+        queries.push_back(key);
+    }
+    for (const uint256_t& query : queries) {
+        auto floor = map.find_floor(query);
+        auto it = expected.upper_bound(query);
+        if (it == expected.begin()) {
+            EXPECT_FALSE(floor.has_value());
+            continue;
+        }
+        --it;
+        ASSERT_TRUE(floor.has_value());
+        EXPECT_EQ(floor->first, it->first);
+        EXPECT_EQ(floor->second, it->second);
+    }
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+}
+
+TEST(ShardedMapTest, OrderedMapConcurrentUpdates)
+{
+    ShardedOrderedMap<std::vector<uint64_t>> map;
+    constexpr uint64_t num_threads = 8;
+    constexpr uint64_t num_updates = 2000;
+    std::vector<uint256_t> keys(16);
+    for (auto& key : keys) {
+        key = random_key();
+    }
+    // The engine is not thread safe, so draw the keys to query up front
+    std::vector<uint256_t> queries(num_updates);
+    for (auto& query : queries) {
+        query = random_key();
+    }
+    std::vector<std::thread> threads;
+    for (uint64_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (uint64_t i = 0; i < num_updates; ++i) {
+                map.update(keys[i % keys.size()], [&](std::vector<uint64_t>& values) { values.push_back(t); });
+                map.find_floor(queries[i]);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    size_t total = 0;
+    map.for_each([&](const uint256_t&, const std::vector<uint64_t>& values) { total += values.size(); });
+    EXPECT_EQ(total, num_threads * num_updates);
+}
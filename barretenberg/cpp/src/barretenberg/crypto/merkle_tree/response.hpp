@@ -26,6 +26,11 @@ struct GetSiblingPathResponse {
     fr_sibling_path path;
 };
 
+struct GetSiblingPathsResponse {
+    // In the order of the requested leaf indices
+    std::vector<fr_sibling_path> paths;
+};
+
 template <typename LeafType> struct LowLeafWitnessData {
     IndexedLeaf<LeafType> leaf;
     index_t index;
@@ -65,6 +70,11 @@ struct GetLowIndexedLeafResponse {
     }
 };
 
+struct GetLowIndexedLeavesResponse {
+    // In the order of the requested leaf keys
+    std::vector<GetLowIndexedLeafResponse> low_leaves;
+};
+
 template <typename ResponseType> struct TypedResponse {
     ResponseType inner;
     bool success{ true };
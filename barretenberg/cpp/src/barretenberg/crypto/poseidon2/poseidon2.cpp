@@ -1,4 +1,5 @@
 #include "poseidon2.hpp"
+#include "barretenberg/common/assert.hpp"
 
 namespace bb::crypto {
 /**
@@ -43,5 +44,47 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash_buffer(const std::vector<
     return hash(converted);
 }
 
+namespace {
+/**
+ * @brief The state the sponge permutes to hash two field elements: the pair in the rate, followed by an empty rate
+ * element and the capacity element holding the IV of a fixed-length hash of 2 elements to 1 output
+ */
+template <typename Permutation, typename FF>
+typename Permutation::State pair_hash_state(const FF& lhs, const FF& rhs)
+{
+    static const FF iv = static_cast<uint256_t>(2) << 64;
+    return { lhs, rhs, FF::zero(), iv };
+}
+} // namespace
+
+template <typename Params>
+typename Poseidon2<Params>::FF Poseidon2<Params>::hash_pair(const FF& lhs, const FF& rhs)
+{
+    return Permutation::permutation(pair_hash_state<Permutation>(lhs, rhs))[0];
+}
+
+template <typename Params> void Poseidon2<Params>::hash_pairs(std::span<const FF> inputs, std::span<FF> outputs)
+{
+    ASSERT(inputs.size() == 2 * outputs.size());
+    const size_t num_pairs = outputs.size();
+    const size_t num_full_batches = num_pairs / HASH_PAIR_LANES;
+
+    std::array<typename Permutation::State, HASH_PAIR_LANES> states;
+    for (size_t batch = 0; batch < num_full_batches; ++batch) {
+        const size_t start = batch * HASH_PAIR_LANES;
+        for (size_t lane = 0; lane < HASH_PAIR_LANES; ++lane) {
+            const size_t i = start + lane;
+            states[lane] = pair_hash_state<Permutation>(inputs[2 * i], inputs[2 * i + 1]);
+        }
+        Permutation::template permutation_lanes<HASH_PAIR_LANES>(states);
+        for (size_t lane = 0; lane < HASH_PAIR_LANES; ++lane) {
+            outputs[start + lane] = states[lane][0];
+        }
+    }
+    for (size_t i = num_full_batches * HASH_PAIR_LANES; i < num_pairs; ++i) {
+        outputs[i] = hash_pair(inputs[2 * i], inputs[2 * i + 1]);
+    }
+}
+
 template class Poseidon2<Poseidon2Bn254ScalarFieldParams>;
 } // namespace bb::crypto
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include "poseidon2_permutation.hpp"
 #include "sponge/sponge.hpp"
 
+#include <span>
+#include <vector>
+
 namespace bb::crypto {
 
 template <typename Params> class Poseidon2 {
@@ -11,7 +14,11 @@ template <typename Params> class Poseidon2 {
     using FF = typename Params::FF;
 
     // We choose our rate to be t-1 and capacity to be 1.
-    using Sponge = FieldSponge<FF, Params::t - 1, 1, Params::t, Poseidon2Permutation<Params>>;
+    using Permutation = Poseidon2Permutation<Params>;
+    using Sponge = FieldSponge<FF, Params::t - 1, 1, Params::t, Permutation>;
+
+    // The number of pairs hash_pairs() permutes together
+    static constexpr size_t HASH_PAIR_LANES = 4;
 
     /**
      * @brief Hashes a vector of field elements
@@ -22,6 +29,16 @@ template <typename Params> class Poseidon2 {
      * @details Slice function cuts out the required number of bytes from the byte vector
      */
     static FF hash_buffer(const std::vector<uint8_t>& input);
+    /**
+     * @brief Hashes two field elements, with the same result as hash({ lhs, rhs }) but without going through the sponge
+     * or allocating
+     */
+    static FF hash_pair(const FF& lhs, const FF& rhs);
+    /**
+     * @brief Computes outputs[i] = hash_pair(inputs[2i], inputs[2i + 1]), e.g. to hash a level of a Merkle tree
+     * @details The pairs are permuted HASH_PAIR_LANES at a time with Permutation::permutation_lanes().
+     */
+    static void hash_pairs(std::span<const FF> inputs, std::span<FF> outputs);
 };
 
 extern template class Poseidon2<Poseidon2Bn254ScalarFieldParams>;
@@ -64,3 +64,32 @@ TEST(Poseidon2, HashBufferConsistencyCheck)
     EXPECT_NE(result1, expected);
     EXPECT_EQ(result2, expected);
 }
+
+TEST(Poseidon2, HashPairMatchesHash)
+{
+    fr a = fr::random_element(&engine);
+    fr b = fr::random_element(&engine);
+
+    auto expected = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash({ a, b });
+    auto result = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash_pair(a, b);
+
+    EXPECT_EQ(result, expected);
+}
+
+TEST(Poseidon2, HashPairsMatchesHashPair)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+    // Numbers of pairs that fill the lanes of the batched permutation, and that leave some pairs over
+    for (size_t num_pairs : { 0UL, 1UL, Poseidon2::HASH_PAIR_LANES, 2 * Poseidon2::HASH_PAIR_LANES + 3 }) {
+        std::vector<fr> inputs(num_pairs * 2);
+        for (auto& input : inputs) {
+            input = fr::random_element(&engine);
+        }
+        std::vector<fr> outputs(num_pairs);
+        Poseidon2::hash_pairs(inputs, outputs);
+
+        for (size_t i = 0; i < num_pairs; ++i) {
+            EXPECT_EQ(outputs[i], Poseidon2::hash_pair(inputs[i * 2], inputs[i * 2 + 1]));
+        }
+    }
+}
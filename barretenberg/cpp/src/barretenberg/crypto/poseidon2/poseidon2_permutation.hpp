@@ -160,5 +160,47 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    /**
+     * @brief Applies the permutation to several independent states at once
+     * @details Each step of the permutation is applied to every state before moving on to the next one. The states do
+     * not depend on each other, so the multiplications of different states can be pipelined. This matters most in the
+     * internal rounds, where each state's only work is the chain of dependent multiplications of a single s-box.
+     * The result is identical to calling permutation() on each state.
+     */
+    template <size_t num_lanes> static constexpr void permutation_lanes(std::array<State, num_lanes>& states)
+    {
+        for (auto& state : states) {
+            matrix_multiplication_external(state);
+        }
+
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            for (auto& state : states) {
+                add_round_constants(state, round_constants[i]);
+                apply_sbox(state);
+                matrix_multiplication_external(state);
+            }
+        }
+
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            for (auto& state : states) {
+                state[0] += round_constants[i][0];
+                apply_single_sbox(state[0]);
+            }
+            for (auto& state : states) {
+                matrix_multiplication_internal(state);
+            }
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            for (auto& state : states) {
+                add_round_constants(state, round_constants[i]);
+                apply_sbox(state);
+                matrix_multiplication_external(state);
+            }
+        }
+    }
 };
 } // namespace bb::crypto
@@ -0,0 +1,410 @@
+#include "field_batch_ops.hpp"
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#if defined(__x86_64__) && !defined(__wasm__) && !defined(DISABLE_ASM)
+#define BB_AVX512_IFMA_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace bb::field_batch_ops {
+
+namespace {
+// Number of field elements processed per vector
+constexpr size_t LANES = 8;
+
+#ifdef BB_AVX512_IFMA_KERNELS
+// Only the kernels are compiled for AVX-512; everything else keeps the baseline target so that the binary still runs
+// on machines without it.
+#define BB_IFMA_TARGET __attribute__((target("avx512f,avx512ifma")))
+
+constexpr size_t NUM_LIMBS = 5;
+constexpr uint64_t LIMB_MASK = (1ULL << 52) - 1;
+
+/**
+ * 8 field elements, one per 64-bit lane, as 5 limbs of 52 bits each (limb i holds bits 52i..52i+51). The values are in
+ * the usual Montgomery form aR mod p with R = 2^256; only the limb layout differs from the scalar representation.
+ */
+struct Vec {
+    __m512i limbs[NUM_LIMBS];
+};
+
+// The 52-bit limbs of a 256-bit value
+std::array<uint64_t, NUM_LIMBS> to_limbs(const uint64_t* data)
+{
+    return { data[0] & LIMB_MASK,
+             ((data[0] >> 52) | (data[1] << 12)) & LIMB_MASK,
+             ((data[1] >> 40) | (data[2] << 24)) & LIMB_MASK,
+             ((data[2] >> 28) | (data[3] << 36)) & LIMB_MASK,
+             data[3] >> 16 };
+}
+
+template <typename Field> struct Constants {
+    Vec modulus;
+    // -p^{-1} mod 2^52
+    __m512i modulus_inverse;
+
+    BB_IFMA_TARGET Constants()
+    {
+        const uint64_t modulus_data[4] = { Field::modulus.data[0],
+                                           Field::modulus.data[1],
+                                           Field::modulus.data[2],
+                                           Field::modulus.data[3] };
+        const auto limbs = to_limbs(modulus_data);
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            modulus.limbs[i] = _mm512_set1_epi64(static_cast<int64_t>(limbs[i]));
+        }
+        modulus_inverse = _mm512_set1_epi64(static_cast<int64_t>(Field::Params::r_inv & LIMB_MASK));
+    }
+};
+
+BB_IFMA_TARGET inline Vec broadcast(const uint64_t* data)
+{
+    const auto limbs = to_limbs(data);
+    Vec result;
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        result.limbs[i] = _mm512_set1_epi64(static_cast<int64_t>(limbs[i]));
+    }
+    return result;
+}
+
+// Permutations transposing between 8 consecutive elements (4 x 64-bit words each) and one vector per word
+BB_IFMA_TARGET inline __m512i interleave_lo()
+{
+    return _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+}
+BB_IFMA_TARGET inline __m512i interleave_hi()
+{
+    return _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+}
+BB_IFMA_TARGET inline __m512i concat_lo()
+{
+    return _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+}
+BB_IFMA_TARGET inline __m512i concat_hi()
+{
+    return _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+}
+
+BB_IFMA_TARGET inline Vec load(const uint64_t* src)
+{
+    const __m512i v0 = _mm512_loadu_si512(src);
+    const __m512i v1 = _mm512_loadu_si512(src + 8);
+    const __m512i v2 = _mm512_loadu_si512(src + 16);
+    const __m512i v3 = _mm512_loadu_si512(src + 24);
+
+    const __m512i a01 = _mm512_permutex2var_epi64(v0, interleave_lo(), v1);
+    const __m512i a23 = _mm512_permutex2var_epi64(v0, interleave_hi(), v1);
+    const __m512i b01 = _mm512_permutex2var_epi64(v2, interleave_lo(), v3);
+    const __m512i b23 = _mm512_permutex2var_epi64(v2, interleave_hi(), v3);
+
+    const __m512i d0 = _mm512_permutex2var_epi64(a01, concat_lo(), b01);
+    const __m512i d1 = _mm512_permutex2var_epi64(a01, concat_hi(), b01);
+    const __m512i d2 = _mm512_permutex2var_epi64(a23, concat_lo(), b23);
+    const __m512i d3 = _mm512_permutex2var_epi64(a23, concat_hi(), b23);
+
+    const __m512i mask = _mm512_set1_epi64(LIMB_MASK);
+    Vec result;
+    result.limbs[0] = _mm512_and_si512(d0, mask);
+    result.limbs[1] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(d0, 52), _mm512_slli_epi64(d1, 12)), mask);
+    result.limbs[2] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(d1, 40), _mm512_slli_epi64(d2, 24)), mask);
+    result.limbs[3] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(d2, 28), _mm512_slli_epi64(d3, 36)), mask);
+    result.limbs[4] = _mm512_srli_epi64(d3, 16);
+    return result;
+}
+
+BB_IFMA_TARGET inline void store(uint64_t* dst, const Vec& x)
+{
+    const __m512i d0 = _mm512_or_si512(x.limbs[0], _mm512_slli_epi64(x.limbs[1], 52));
+    const __m512i d1 = _mm512_or_si512(_mm512_srli_epi64(x.limbs[1], 12), _mm512_slli_epi64(x.limbs[2], 40));
+    const __m512i d2 = _mm512_or_si512(_mm512_srli_epi64(x.limbs[2], 24), _mm512_slli_epi64(x.limbs[3], 28));
+    const __m512i d3 = _mm512_or_si512(_mm512_srli_epi64(x.limbs[3], 36), _mm512_slli_epi64(x.limbs[4], 16));
+
+    const __m512i a01 = _mm512_permutex2var_epi64(d0, concat_lo(), d1);
+    const __m512i b01 = _mm512_permutex2var_epi64(d0, concat_hi(), d1);
+    const __m512i a23 = _mm512_permutex2var_epi64(d2, concat_lo(), d3);
+    const __m512i b23 = _mm512_permutex2var_epi64(d2, concat_hi(), d3);
+
+    _mm512_storeu_si512(dst, _mm512_permutex2var_epi64(a01, interleave_lo(), a23));
+    _mm512_storeu_si512(dst + 8, _mm512_permutex2var_epi64(a01, interleave_hi(), a23));
+    _mm512_storeu_si512(dst + 16, _mm512_permutex2var_epi64(b01, interleave_lo(), b23));
+    _mm512_storeu_si512(dst + 24, _mm512_permutex2var_epi64(b01, interleave_hi(), b23));
+}
+
+// Subtract p if x >= p. Takes normalized limbs.
+template <typename Field> BB_IFMA_TARGET inline void reduce_once(Vec& x, const Constants<Field>& constants)
+{
+    const __m512i mask = _mm512_set1_epi64(LIMB_MASK);
+    __m512i borrow = _mm512_setzero_si512();
+    Vec difference;
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        const __m512i limb = _mm512_sub_epi64(_mm512_sub_epi64(x.limbs[i], constants.modulus.limbs[i]), borrow);
+        borrow = _mm512_srli_epi64(limb, 63);
+        difference.limbs[i] = _mm512_and_si512(limb, mask);
+    }
+    const __mmask8 no_borrow = _mm512_cmpeq_epi64_mask(borrow, _mm512_setzero_si512());
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        x.limbs[i] = _mm512_mask_blend_epi64(no_borrow, x.limbs[i], difference.limbs[i]);
+    }
+}
+
+/**
+ * Montgomery multiplication a * b / 2^256 mod p for inputs in [0, 2p), with the result fully reduced.
+ * Each of the first four rounds adds a_i * b and divides by 2^52; the last round divides by 2^48 only, so that the
+ * overall factor matches the R = 2^256 used by the scalar field arithmetic.
+ */
+template <typename Field>
+BB_IFMA_TARGET inline Vec mont_mul(const Vec& a, const Vec& b, const Constants<Field>& constants)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i mask = _mm512_set1_epi64(LIMB_MASK);
+    const __m512i* p = constants.modulus.limbs;
+    __m512i z[NUM_LIMBS + 1] = { zero, zero, zero, zero, zero, zero };
+
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            z[j] = _mm512_madd52lo_epu64(z[j], a.limbs[i], b.limbs[j]);
+            z[j + 1] = _mm512_madd52hi_epu64(z[j + 1], a.limbs[i], b.limbs[j]);
+        }
+        __m512i m = _mm512_madd52lo_epu64(zero, z[0], constants.modulus_inverse);
+        if (i == NUM_LIMBS - 1) {
+            m = _mm512_and_si512(m, _mm512_set1_epi64((1ULL << 48) - 1));
+        }
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            z[j] = _mm512_madd52lo_epu64(z[j], m, p[j]);
+            z[j + 1] = _mm512_madd52hi_epu64(z[j + 1], m, p[j]);
+        }
+        if (i < NUM_LIMBS - 1) {
+            // z[0] is now divisible by 2^52
+            z[1] = _mm512_add_epi64(z[1], _mm512_srli_epi64(z[0], 52));
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                z[j] = z[j + 1];
+            }
+            z[NUM_LIMBS] = zero;
+        }
+    }
+
+    for (size_t j = 0; j < NUM_LIMBS; ++j) {
+        z[j + 1] = _mm512_add_epi64(z[j + 1], _mm512_srli_epi64(z[j], 52));
+        z[j] = _mm512_and_si512(z[j], mask);
+    }
+    // The low 48 bits are now zero; shift them out
+    Vec result;
+    for (size_t j = 0; j < NUM_LIMBS; ++j) {
+        result.limbs[j] =
+            _mm512_or_si512(_mm512_srli_epi64(z[j], 48), _mm512_and_si512(_mm512_slli_epi64(z[j + 1], 4), mask));
+    }
+    reduce_once(result, constants);
+    return result;
+}
+
+// a + b for a in [0, 2p), b in [0, p), reduced to [0, p)
+template <typename Field>
+BB_IFMA_TARGET inline Vec add(const Vec& a, const Vec& b, const Constants<Field>& constants)
+{
+    const __m512i mask = _mm512_set1_epi64(LIMB_MASK);
+    Vec result;
+    __m512i carry = _mm512_setzero_si512();
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        const __m512i limb = _mm512_add_epi64(_mm512_add_epi64(a.limbs[i], b.limbs[i]), carry);
+        carry = _mm512_srli_epi64(limb, 52);
+        result.limbs[i] = _mm512_and_si512(limb, mask);
+    }
+    reduce_once(result, constants);
+    reduce_once(result, constants);
+    return result;
+}
+
+// Lanes holding 0 or p, i.e. the two representations of zero
+template <typename Field>
+BB_IFMA_TARGET inline __mmask8 is_zero(const Vec& x, const Constants<Field>& constants)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    __mmask8 equals_zero = 0xff;
+    __mmask8 equals_modulus = 0xff;
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        equals_zero &= _mm512_cmpeq_epi64_mask(x.limbs[i], zero);
+        equals_modulus &= _mm512_cmpeq_epi64_mask(x.limbs[i], constants.modulus.limbs[i]);
+    }
+    return equals_zero | equals_modulus;
+}
+
+BB_IFMA_TARGET inline Vec blend(__mmask8 mask, const Vec& a, const Vec& b)
+{
+    Vec result;
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        result.limbs[i] = _mm512_mask_blend_epi64(mask, a.limbs[i], b.limbs[i]);
+    }
+    return result;
+}
+
+template <typename Field> const uint64_t* words(const Field* x)
+{
+    return &x->data[0];
+}
+template <typename Field> uint64_t* words(Field* x)
+{
+    return &x->data[0];
+}
+
+// The kernels below process the first `num_vectors * LANES` elements
+template <typename Field>
+BB_IFMA_TARGET void mul_ifma(const Field* a, const Field* b, Field* out, size_t num_vectors)
+{
+    const Constants<Field> constants;
+    for (size_t i = 0; i < num_vectors; ++i) {
+        const Vec x = load(words(a + i * LANES));
+        const Vec y = load(words(b + i * LANES));
+        store(words(out + i * LANES), mont_mul(x, y, constants));
+    }
+}
+
+template <typename Field>
+BB_IFMA_TARGET void scale_ifma(const Field* a, const Field& scalar, Field* out, size_t num_vectors)
+{
+    const Constants<Field> constants;
+    const Vec s = broadcast(words(&scalar));
+    for (size_t i = 0; i < num_vectors; ++i) {
+        store(words(out + i * LANES), mont_mul(load(words(a + i * LANES)), s, constants));
+    }
+}
+
+template <typename Field>
+BB_IFMA_TARGET void add_scaled_ifma(Field* a, const Field* b, const Field& scalar, size_t num_vectors)
+{
+    const Constants<Field> constants;
+    const Vec s = broadcast(words(&scalar));
+    for (size_t i = 0; i < num_vectors; ++i) {
+        const Vec product = mont_mul(load(words(b + i * LANES)), s, constants);
+        store(words(a + i * LANES), add(load(words(a + i * LANES)), product, constants));
+    }
+}
+
+/**
+ * Montgomery's batch inversion with 8 independent running products, lane j covering the elements congruent to j mod 8.
+ * The 8 lane products are inverted together with the scalar batch inversion. The intermediate products are kept in
+ * limb form so that the backward pass does not have to convert them again.
+ */
+template <typename Field> BB_IFMA_TARGET void batch_invert_ifma(Field* coeffs, size_t num_vectors)
+{
+    const Constants<Field> constants;
+    const Field one = Field::one();
+    const Vec one_vec = broadcast(words(&one));
+    auto temporaries = std::make_unique<Vec[]>(num_vectors);
+
+    Vec accumulator = one_vec;
+    for (size_t i = 0; i < num_vectors; ++i) {
+        const Vec x = load(words(coeffs + i * LANES));
+        temporaries[i] = accumulator;
+        accumulator = mont_mul(accumulator, blend(is_zero(x, constants), x, one_vec), constants);
+    }
+
+    std::array<Field, LANES> lane_products;
+    store(words(lane_products.data()), accumulator);
+    Field::batch_invert(lane_products);
+    accumulator = load(words(lane_products.data()));
+
+    for (size_t i = num_vectors; i-- > 0;) {
+        const Vec x = load(words(coeffs + i * LANES));
+        const __mmask8 zero_mask = is_zero(x, constants);
+        const Vec inverse = mont_mul(accumulator, temporaries[i], constants);
+        accumulator = mont_mul(accumulator, blend(zero_mask, x, one_vec), constants);
+        store(words(coeffs + i * LANES), blend(zero_mask, inverse, x));
+    }
+}
+#endif
+} // namespace
+
+bool use_avx512_ifma()
+{
+#ifdef BB_AVX512_IFMA_KERNELS
+    static const bool enabled = []() {
+        const char* disable = std::getenv("BB_DISABLE_AVX512_IFMA");
+        if (disable != nullptr && std::string(disable) == "1") {
+            return false;
+        }
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+    }();
+    return enabled;
+#else
+    return false;
+#endif
+}
+
+namespace detail {
+
+template <typename Field> void mul(std::span<const Field> a, std::span<const Field> b, std::span<Field> out)
+{
+    size_t i = 0;
+#ifdef BB_AVX512_IFMA_KERNELS
+    if (use_avx512_ifma()) {
+        const size_t num_vectors = out.size() / LANES;
+        mul_ifma(a.data(), b.data(), out.data(), num_vectors);
+        i = num_vectors * LANES;
+    }
+#endif
+    for (; i < out.size(); ++i) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+template <typename Field> void scale(std::span<const Field> a, const Field& scalar, std::span<Field> out)
+{
+    size_t i = 0;
+#ifdef BB_AVX512_IFMA_KERNELS
+    if (use_avx512_ifma()) {
+        const size_t num_vectors = out.size() / LANES;
+        scale_ifma(a.data(), scalar, out.data(), num_vectors);
+        i = num_vectors * LANES;
+    }
+#endif
+    for (; i < out.size(); ++i) {
+        out[i] = a[i] * scalar;
+    }
+}
+
+template <typename Field> void add_scaled(std::span<Field> a, std::span<const Field> b, const Field& scalar)
+{
+    size_t i = 0;
+#ifdef BB_AVX512_IFMA_KERNELS
+    if (use_avx512_ifma()) {
+        const size_t num_vectors = a.size() / LANES;
+        add_scaled_ifma(a.data(), b.data(), scalar, num_vectors);
+        i = num_vectors * LANES;
+    }
+#endif
+    for (; i < a.size(); ++i) {
+        a[i] += scalar * b[i];
+    }
+}
+
+template <typename Field> void batch_invert(std::span<Field> coeffs)
+{
+#ifdef BB_AVX512_IFMA_KERNELS
+    // Below this size the extra inversion of the tail is not worth it
+    constexpr size_t MIN_VECTOR_INVERSION_SIZE = 64;
+    if (use_avx512_ifma() && coeffs.size() >= MIN_VECTOR_INVERSION_SIZE) {
+        const size_t num_vectors = coeffs.size() / LANES;
+        batch_invert_ifma(coeffs.data(), num_vectors);
+        Field::batch_invert(coeffs.subspan(num_vectors * LANES));
+        return;
+    }
+#endif
+    Field::batch_invert(coeffs);
+}
+
+template void mul<bb::fr>(std::span<const bb::fr>, std::span<const bb::fr>, std::span<bb::fr>);
+template void mul<bb::fq>(std::span<const bb::fq>, std::span<const bb::fq>, std::span<bb::fq>);
+template void scale<bb::fr>(std::span<const bb::fr>, const bb::fr&, std::span<bb::fr>);
+template void scale<bb::fq>(std::span<const bb::fq>, const bb::fq&, std::span<bb::fq>);
+template void add_scaled<bb::fr>(std::span<bb::fr>, std::span<const bb::fr>, const bb::fr&);
+template void add_scaled<bb::fq>(std::span<bb::fq>, std::span<const bb::fq>, const bb::fq&);
+template void batch_invert<bb::fr>(std::span<bb::fr>);
+template void batch_invert<bb::fq>(std::span<bb::fq>);
+
+} // namespace detail
+} // namespace bb::field_batch_ops
@@ -0,0 +1,93 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/ecc/curves/bn254/fq.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+/**
+ * @brief Batch kernels for element-wise field arithmetic over arrays
+ * @details For the BN254 base and scalar fields these dispatch at runtime to an AVX-512 IFMA implementation when the
+ * CPU supports it, which processes 8 elements per instruction in a 5 x 52-bit limb representation. Otherwise, and for
+ * any other field, they fall back to the scalar field arithmetic. Results are identical on either path.
+ *
+ * Output spans may alias the corresponding input spans.
+ */
+namespace bb::field_batch_ops {
+
+template <typename Field>
+concept HasVectorKernels = std::same_as<Field, bb::fr> || std::same_as<Field, bb::fq>;
+
+/**
+ * @brief Whether the AVX-512 IFMA kernels are used on this machine. Set BB_DISABLE_AVX512_IFMA=1 in the environment
+ * to force the scalar kernels.
+ */
+bool use_avx512_ifma();
+
+namespace detail {
+template <typename Field> void mul(std::span<const Field> a, std::span<const Field> b, std::span<Field> out);
+template <typename Field> void scale(std::span<const Field> a, const Field& scalar, std::span<Field> out);
+template <typename Field> void add_scaled(std::span<Field> a, std::span<const Field> b, const Field& scalar);
+template <typename Field> void batch_invert(std::span<Field> coeffs);
+} // namespace detail
+
+/**
+ * @brief out[i] = a[i] * b[i]
+ */
+template <typename Field> void mul(std::span<const Field> a, std::span<const Field> b, std::span<Field> out)
+{
+    ASSERT(a.size() == b.size() && a.size() == out.size());
+    if constexpr (HasVectorKernels<Field>) {
+        detail::mul(a, b, out);
+    } else {
+        for (size_t i = 0; i < out.size(); ++i) {
+            out[i] = a[i] * b[i];
+        }
+    }
+}
+
+/**
+ * @brief out[i] = a[i] * scalar
+ */
+template <typename Field> void scale(std::span<const Field> a, const Field& scalar, std::span<Field> out)
+{
+    ASSERT(a.size() == out.size());
+    if constexpr (HasVectorKernels<Field>) {
+        detail::scale(a, scalar, out);
+    } else {
+        for (size_t i = 0; i < out.size(); ++i) {
+            out[i] = a[i] * scalar;
+        }
+    }
+}
+
+/**
+ * @brief a[i] += scalar * b[i]
+ */
+template <typename Field> void add_scaled(std::span<Field> a, std::span<const Field> b, const Field& scalar)
+{
+    ASSERT(a.size() == b.size());
+    if constexpr (HasVectorKernels<Field>) {
+        detail::add_scaled(a, b, scalar);
+    } else {
+        for (size_t i = 0; i < a.size(); ++i) {
+            a[i] += scalar * b[i];
+        }
+    }
+}
+
+/**
+ * @brief Invert every nonzero element in place; zero elements are left untouched. Same semantics as
+ * field::batch_invert.
+ */
+template <typename Field> void batch_invert(std::span<Field> coeffs)
+{
+    if constexpr (HasVectorKernels<Field>) {
+        detail::batch_invert(coeffs);
+    } else {
+        Field::batch_invert(coeffs);
+    }
+}
+
+} // namespace bb::field_batch_ops
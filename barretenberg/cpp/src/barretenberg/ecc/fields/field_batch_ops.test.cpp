@@ -0,0 +1,123 @@
+#include "field_batch_ops.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+}
+
+template <typename Field> class FieldBatchOpsTest : public ::testing::Test {
+  public:
+    static uint256_t raw(const Field& x) { return { x.data[0], x.data[1], x.data[2], x.data[3] }; }
+
+    // The representative of x in [p, 2p)
+    static Field non_canonical(const Field& x)
+    {
+        const uint256_t value = raw(x.reduce_once()) + Field::modulus;
+        Field result;
+        for (size_t i = 0; i < 4; ++i) {
+            result.data[i] = value.data[i];
+        }
+        return result;
+    }
+
+    // Random elements, some of them zero and some in the non-canonical range [p, 2p)
+    static std::vector<Field> random_elements(size_t n)
+    {
+        std::vector<Field> result(n);
+        for (size_t i = 0; i < n; ++i) {
+            result[i] = Field::random_element(&engine);
+            if (i % 11 == 3) {
+                result[i] = Field::zero();
+            } else if (i % 13 == 5) {
+                result[i] = non_canonical(result[i]);
+            }
+        }
+        return result;
+    }
+};
+
+using Fields = ::testing::Types<bb::fr, bb::fq>;
+TYPED_TEST_SUITE(FieldBatchOpsTest, Fields);
+
+// Sizes covering empty input, input shorter than a vector and a partial final vector
+const std::vector<size_t> SIZES = { 0, 5, 8, 64, 203 };
+
+TYPED_TEST(FieldBatchOpsTest, Mul)
+{
+    using Field = TypeParam;
+    for (size_t n : SIZES) {
+        auto a = TestFixture::random_elements(n);
+        auto b = TestFixture::random_elements(n);
+        std::vector<Field> out(n);
+        field_batch_ops::mul<Field>(a, b, out);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(out[i], a[i] * b[i]);
+        }
+        // In place
+        field_batch_ops::mul<Field>(a, b, a);
+        EXPECT_EQ(a, out);
+    }
+}
+
+TYPED_TEST(FieldBatchOpsTest, Scale)
+{
+    using Field = TypeParam;
+    for (size_t n : SIZES) {
+        auto a = TestFixture::random_elements(n);
+        const Field scalar = Field::random_element(&engine);
+        std::vector<Field> out(n);
+        field_batch_ops::scale<Field>(a, scalar, out);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(out[i], a[i] * scalar);
+        }
+    }
+}
+
+TYPED_TEST(FieldBatchOpsTest, AddScaled)
+{
+    using Field = TypeParam;
+    for (size_t n : SIZES) {
+        auto a = TestFixture::random_elements(n);
+        auto b = TestFixture::random_elements(n);
+        const Field scalar = Field::random_element(&engine);
+        auto expected = a;
+        for (size_t i = 0; i < n; ++i) {
+            expected[i] += scalar * b[i];
+        }
+        field_batch_ops::add_scaled<Field>(a, b, scalar);
+        EXPECT_EQ(a, expected);
+    }
+}
+
+TYPED_TEST(FieldBatchOpsTest, BatchInvert)
+{
+    using Field = TypeParam;
+    for (size_t n : SIZES) {
+        auto a = TestFixture::random_elements(n);
+        auto expected = a;
+        Field::batch_invert(expected);
+        field_batch_ops::batch_invert<Field>(a);
+        EXPECT_EQ(a, expected);
+    }
+}
+
+TYPED_TEST(FieldBatchOpsTest, Reduced)
+{
+    // Outputs must be valid field elements (i.e. less than 2p) even for inputs at the top of the range. The vector
+    // kernels reduce fully.
+    using Field = TypeParam;
+    const Field max = TestFixture::non_canonical(-Field::one());
+    std::vector<Field> a(16, max);
+    std::vector<Field> out(16);
+    field_batch_ops::mul<Field>(a, a, out);
+    const uint256_t bound = field_batch_ops::use_avx512_ifma() ? uint256_t(Field::modulus) : Field::modulus + Field::modulus;
+    for (auto& x : out) {
+        EXPECT_LT(TestFixture::raw(x), bound);
+        EXPECT_EQ(x, Field::one());
+    }
+}
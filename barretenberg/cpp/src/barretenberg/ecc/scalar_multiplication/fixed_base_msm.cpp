@@ -0,0 +1,288 @@
+#include "fixed_base_msm.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+namespace {
+// Number of bucket additions sharing one field inversion
+constexpr size_t MAX_BATCH_SIZE = 1024;
+// Number of bases whose multiples are normalized together when building the table
+constexpr size_t TABLE_BLOCK_SIZE = 64;
+
+std::atomic<size_t>& fixed_base_msm_memory_budget()
+{
+    static std::atomic<size_t> budget = []() -> size_t {
+        const char* value = std::getenv("BB_FIXED_BASE_MSM_MEMORY_MB");
+        return value == nullptr ? 0 : std::stoull(value) << 20;
+    }();
+    return budget;
+}
+} // namespace
+
+size_t get_fixed_base_msm_memory_budget()
+{
+    return fixed_base_msm_memory_budget().load();
+}
+
+void set_fixed_base_msm_memory_budget(size_t num_bytes)
+{
+    fixed_base_msm_memory_budget().store(num_bytes);
+}
+
+template <typename Curve>
+FixedBaseMsm<Curve>::FixedBaseMsm(std::span<const AffineElement> point_table,
+                                  size_t num_points,
+                                  size_t bits_per_window)
+    : num_points(num_points)
+    , bits_per_window(bits_per_window)
+    , num_windows(get_num_windows(bits_per_window))
+    , num_buckets(1UL << (bits_per_window - 1))
+    , table(new AffineElement[num_points * num_windows])
+{
+    PROFILE_THIS();
+    ASSERT(bits_per_window >= MIN_BITS_PER_WINDOW && bits_per_window <= MAX_BITS_PER_WINDOW);
+    ASSERT(2 * num_points <= point_table.size());
+
+    parallel_for_range(num_points, [&](size_t start, size_t end) {
+        std::vector<Element> multiples(TABLE_BLOCK_SIZE * num_windows);
+        for (size_t block_start = start; block_start < end; block_start += TABLE_BLOCK_SIZE) {
+            const size_t block_end = std::min(end, block_start + TABLE_BLOCK_SIZE);
+            const size_t num_multiples = (block_end - block_start) * num_windows;
+            for (size_t i = block_start; i < block_end; ++i) {
+                Element* point_multiples = &multiples[(i - block_start) * num_windows];
+                point_multiples[0] = Element(point_table[2 * i]);
+                for (size_t j = 1; j < num_windows; ++j) {
+                    point_multiples[j] = point_multiples[j - 1];
+                    for (size_t k = 0; k < bits_per_window; ++k) {
+                        point_multiples[j].self_dbl();
+                    }
+                }
+            }
+            Element::batch_normalize(multiples.data(), num_multiples);
+            for (size_t k = 0; k < num_multiples; ++k) {
+                table[block_start * num_windows + k] = AffineElement(multiples[k].x, multiples[k].y);
+            }
+        }
+    });
+}
+
+template <typename Curve>
+size_t FixedBaseMsm<Curve>::get_optimal_bits_per_window(size_t num_points, size_t memory_budget)
+{
+    // A batched affine bucket addition costs ~6 field multiplications. Reducing the buckets costs two jacobian
+    // additions, i.e. ~4 times as much, per bucket, and every thread reduces its own buckets.
+    const size_t num_threads = get_num_cpus();
+    size_t best_bits_per_window = 0;
+    size_t best_cost = std::numeric_limits<size_t>::max();
+    for (size_t bits = MIN_BITS_PER_WINDOW; bits <= MAX_BITS_PER_WINDOW; ++bits) {
+        if (get_table_size(num_points, bits) > memory_budget) {
+            continue;
+        }
+        const size_t cost = get_num_windows(bits) * num_points / num_threads + (4UL << (bits - 1));
+        if (cost < best_cost) {
+            best_cost = cost;
+            best_bits_per_window = bits;
+        }
+    }
+    return best_bits_per_window;
+}
+
+template <typename Curve>
+std::shared_ptr<FixedBaseMsm<Curve>> FixedBaseMsm<Curve>::create_within_budget(
+    std::span<const AffineElement> point_table, size_t num_points, size_t memory_budget)
+{
+    size_t bits_per_window = get_optimal_bits_per_window(num_points, memory_budget);
+    if (bits_per_window == 0) {
+        num_points = numeric::round_up_power_2(num_points);
+    }
+    while (bits_per_window == 0 && num_points > MIN_NUM_POINTS) {
+        num_points /= 2;
+        bits_per_window = get_optimal_bits_per_window(num_points, memory_budget);
+    }
+    if (bits_per_window == 0) {
+        return nullptr;
+    }
+    vinfo("precomputing fixed-base MSM table for ",
+          num_points,
+          " ",
+          Curve::name,
+          " points with ",
+          bits_per_window,
+          "-bit windows (",
+          get_table_size(num_points, bits_per_window) >> 20,
+          " MiB)");
+    return std::make_shared<FixedBaseMsm>(point_table, num_points, bits_per_window);
+}
+
+template <typename Curve> bool FixedBaseMsm<Curve>::is_efficient_for(size_t num_scalars) const
+{
+    return num_scalars * num_windows >= 16 * num_buckets;
+}
+
+template <typename Curve>
+typename Curve::Element FixedBaseMsm<Curve>::msm(std::span<const Fr> scalars, size_t start_index) const
+{
+    PROFILE_THIS();
+    ASSERT(start_index + scalars.size() <= num_points);
+
+    // Each thread accumulates a slice of the scalars into its own buckets. Only use as many threads as keep the
+    // bucket reduction small next to the bucket additions.
+    const size_t num_additions = scalars.size() * num_windows;
+    const size_t num_threads = std::clamp(num_additions / (4 * num_buckets), size_t(1), get_num_cpus());
+    const size_t slice_size = (scalars.size() + num_threads - 1) / num_threads;
+    std::vector<Element> thread_results(num_threads);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(scalars.size(), thread_idx * slice_size);
+        const size_t end = std::min(scalars.size(), start + slice_size);
+        thread_results[thread_idx] = accumulate(scalars.subspan(start, end - start), start_index + start);
+    });
+
+    Element result = thread_results[0];
+    for (size_t i = 1; i < num_threads; ++i) {
+        result += thread_results[i];
+    }
+    return result;
+}
+
+template <typename Curve>
+typename Curve::Element FixedBaseMsm<Curve>::accumulate(std::span<const Fr> scalars, size_t start_index) const
+{
+    std::vector<AffineElement> buckets(num_buckets);
+    for (auto& bucket : buckets) {
+        bucket.self_set_infinity();
+    }
+    std::vector<uint8_t> bucket_is_busy(num_buckets, 0);
+    const size_t batch_size = std::min(MAX_BATCH_SIZE, num_buckets / 4);
+    std::vector<BucketAddition> batch;
+    std::vector<BucketAddition> deferred;
+    std::vector<BucketAddition> retry;
+    std::vector<Fq> scratch_space;
+    batch.reserve(2 * batch_size);
+
+    const auto add_to_bucket = [&](const BucketAddition& addition) {
+        AffineElement& bucket = buckets[addition.bucket];
+        if (bucket_is_busy[addition.bucket] != 0) {
+            deferred.emplace_back(addition);
+        } else if (bucket.is_point_at_infinity()) {
+            bucket = addition.negate ? -*addition.point : *addition.point;
+        } else {
+            bucket_is_busy[addition.bucket] = 1;
+            batch.emplace_back(addition);
+        }
+    };
+    // Add the current batch, then requeue the additions it deferred
+    const auto flush = [&]() {
+        add_batch(batch, buckets, bucket_is_busy, scratch_space);
+        std::swap(retry, deferred);
+        deferred.clear();
+        for (const auto& addition : retry) {
+            add_to_bucket(addition);
+        }
+        retry.clear();
+    };
+
+    const uint64_t window_mask = (1ULL << bits_per_window) - 1;
+    const auto half_window = static_cast<uint64_t>(num_buckets);
+    for (size_t i = 0; i < scalars.size(); ++i) {
+        if (scalars[i].is_zero()) {
+            continue;
+        }
+        const Fr scalar = scalars[i].from_montgomery_form();
+        const AffineElement* multiples = &table[(start_index + i) * num_windows];
+        uint64_t carry = 0;
+        for (size_t j = 0; j < num_windows; ++j) {
+            const size_t bit_offset = j * bits_per_window;
+            const size_t limb = bit_offset / 64;
+            const size_t shift = bit_offset % 64;
+            uint64_t digit = limb < 4 ? scalar.data[limb] >> shift : 0;
+            if (shift + bits_per_window > 64 && limb + 1 < 4) {
+                digit |= scalar.data[limb + 1] << (64 - shift);
+            }
+            digit = (digit & window_mask) + carry;
+            // Map the digit into (-2^{c-1}, 2^{c-1}]
+            carry = digit > half_window ? 1 : 0;
+            const bool negate = carry != 0;
+            const uint64_t magnitude = negate ? (1ULL << bits_per_window) - digit : digit;
+            if (magnitude != 0) {
+                add_to_bucket({ &multiples[j], static_cast<uint32_t>(magnitude - 1), negate });
+            }
+        }
+        ASSERT(carry == 0);
+        if (batch.size() >= batch_size) {
+            flush();
+        }
+    }
+    while (!batch.empty() || !deferred.empty()) {
+        flush();
+    }
+
+    // ∑ⱼ (j + 1)⋅Bⱼ as a running sum of running sums
+    Element running_sum;
+    Element result;
+    running_sum.self_set_infinity();
+    result.self_set_infinity();
+    for (size_t j = num_buckets; j-- > 0;) {
+        if (!buckets[j].is_point_at_infinity()) {
+            running_sum += buckets[j];
+        }
+        result += running_sum;
+    }
+    return result;
+}
+
+/**
+ * @brief Perform the additions of a batch, each into a distinct bucket, sharing a single field inversion
+ */
+template <typename Curve>
+void FixedBaseMsm<Curve>::add_batch(std::vector<BucketAddition>& batch,
+                                    std::vector<AffineElement>& buckets,
+                                    std::vector<uint8_t>& bucket_is_busy,
+                                    std::vector<Fq>& scratch_space)
+{
+    // Montgomery's trick over the slope denominators x_P - x_B. A zero denominator means P = ±B, which is left to the
+    // (rare) slow path below.
+    scratch_space.resize(batch.size());
+    Fq accumulator = Fq::one();
+    for (size_t i = 0; i < batch.size(); ++i) {
+        scratch_space[i] = accumulator;
+        const Fq denominator = batch[i].point->x - buckets[batch[i].bucket].x;
+        if (!denominator.is_zero()) {
+            accumulator *= denominator;
+        }
+    }
+    accumulator = accumulator.invert();
+
+    for (size_t i = batch.size(); i-- > 0;) {
+        const BucketAddition& addition = batch[i];
+        AffineElement& bucket = buckets[addition.bucket];
+        bucket_is_busy[addition.bucket] = 0;
+        const AffineElement point = addition.negate ? -*addition.point : *addition.point;
+        const Fq denominator = point.x - bucket.x;
+        if (denominator.is_zero()) {
+            bucket = AffineElement(Element(bucket) + point);
+            continue;
+        }
+        const Fq inverse = accumulator * scratch_space[i];
+        accumulator *= denominator;
+        const Fq lambda = (point.y - bucket.y) * inverse;
+        const Fq x = lambda.sqr() - bucket.x - point.x;
+        bucket.y = lambda * (bucket.x - x) - bucket.y;
+        bucket.x = x;
+    }
+    batch.clear();
+}
+
+template class FixedBaseMsm<curve::BN254>;
+template class FixedBaseMsm<curve::Grumpkin>;
+
+} // namespace bb::scalar_multiplication
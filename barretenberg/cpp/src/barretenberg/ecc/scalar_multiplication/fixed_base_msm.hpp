@@ -0,0 +1,127 @@
+#pragma once
+
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * @brief Multi-scalar multiplication against a fixed set of bases, using per-window multiples of the bases that are
+ * precomputed once
+ *
+ * @details With the scalars written in signed base 2^c digits, sᵢ = ∑ⱼ dᵢⱼ⋅2^{cj} with |dᵢⱼ| ≤ 2^{c-1}, an MSM is
+ *
+ *      ∑ᵢ sᵢ⋅Pᵢ = ∑ᵢ ∑ⱼ dᵢⱼ⋅(2^{cj}⋅Pᵢ)
+ *
+ * Given a table of the points 2^{cj}⋅Pᵢ this is a single bucket method round over num_windows times as many points,
+ * with small scalars. Compared with pippenger this drops the doublings between rounds and, more importantly, the bucket
+ * reduction is paid once rather than once per round, which makes much wider windows worthwhile. The price is a table of
+ * num_windows affine points per base. Signed digits halve the number of buckets, as negating an affine point is free.
+ *
+ * Points are accumulated into buckets held in affine form using batched affine additions: additions into distinct
+ * buckets are collected into a batch and all of their slope denominators are inverted together with Montgomery's trick.
+ * An addition that targets a bucket already in the current batch is deferred to the next one.
+ *
+ * @warning The bases must be distinct and of prime order, as for an SRS; the identity is not supported as a base.
+ */
+template <typename Curve> class FixedBaseMsm {
+  public:
+    using Fr = typename Curve::ScalarField;
+    using Fq = typename Curve::BaseField;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    static constexpr size_t NUM_SCALAR_BITS = static_cast<size_t>(uint256_t(Fr::modulus).get_msb()) + 1;
+    static constexpr size_t MIN_BITS_PER_WINDOW = 8;
+    static constexpr size_t MAX_BITS_PER_WINDOW = 20;
+    // Below this many bases pippenger is as fast and the table is not worth its memory
+    static constexpr size_t MIN_NUM_POINTS = 1 << 14;
+
+    /**
+     * @brief Precompute the window table for the first num_points bases
+     *
+     * @param point_table a pippenger point table, i.e. the bases at even indices (see generate_pippenger_point_table)
+     * @param num_points the number of bases to cover
+     * @param bits_per_window the window width c
+     */
+    FixedBaseMsm(std::span<const AffineElement> point_table, size_t num_points, size_t bits_per_window);
+
+    /**
+     * @brief Compute ∑ᵢ sᵢ⋅P_{start_index + i}
+     */
+    Element msm(std::span<const Fr> scalars, size_t start_index = 0) const;
+
+    /**
+     * @brief Whether msm is expected to beat pippenger for an MSM with num_scalars scalars. Wide windows are a poor fit
+     * for small MSMs, as the cost of reducing the buckets is independent of the number of points.
+     */
+    bool is_efficient_for(size_t num_scalars) const;
+
+    size_t get_num_points() const { return num_points; }
+    size_t get_bits_per_window() const { return bits_per_window; }
+
+    static size_t get_num_windows(size_t bits_per_window)
+    {
+        // One bit more than the scalars, to absorb the carry out of the top signed digit
+        return (NUM_SCALAR_BITS + bits_per_window) / bits_per_window;
+    }
+
+    /**
+     * @brief Size in bytes of the precomputed table for num_points bases
+     */
+    static size_t get_table_size(size_t num_points, size_t bits_per_window)
+    {
+        return num_points * get_num_windows(bits_per_window) * sizeof(AffineElement);
+    }
+
+    /**
+     * @brief The window width minimising the cost of a full size MSM whose table fits in memory_budget bytes, or 0 if
+     * there is none.
+     */
+    static size_t get_optimal_bits_per_window(size_t num_points, size_t memory_budget);
+
+    /**
+     * @brief Precompute the table for as many of the bases as fit in memory_budget bytes: all num_points of them if
+     * possible, otherwise the largest power of two prefix
+     * @return nullptr if not even MIN_NUM_POINTS bases fit
+     */
+    static std::shared_ptr<FixedBaseMsm> create_within_budget(std::span<const AffineElement> point_table,
+                                                              size_t num_points,
+                                                              size_t memory_budget);
+
+  private:
+    struct BucketAddition {
+        const AffineElement* point;
+        uint32_t bucket;
+        bool negate;
+    };
+
+    Element accumulate(std::span<const Fr> scalars, size_t start_index) const;
+    static void add_batch(std::vector<BucketAddition>& batch,
+                          std::vector<AffineElement>& buckets,
+                          std::vector<uint8_t>& bucket_is_busy,
+                          std::vector<Fq>& scratch_space);
+
+    size_t num_points;
+    size_t bits_per_window;
+    size_t num_windows;
+    size_t num_buckets;
+    // table[i * num_windows + j] = 2^{cj}⋅Pᵢ
+    std::unique_ptr<AffineElement[]> table;
+};
+
+/**
+ * @brief Memory budget in bytes for the fixed-base MSM table of a prover SRS; 0 disables fixed-base MSMs
+ * @details Defaults to the value of the BB_FIXED_BASE_MSM_MEMORY_MB environment variable (in MiB), or 0 if unset.
+ */
+size_t get_fixed_base_msm_memory_budget();
+void set_fixed_base_msm_memory_budget(size_t num_bytes);
+
+extern template class FixedBaseMsm<curve::BN254>;
+extern template class FixedBaseMsm<curve::Grumpkin>;
+
+} // namespace bb::scalar_multiplication
@@ -0,0 +1,98 @@
+#include "fixed_base_msm.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace bb;
+using namespace bb::scalar_multiplication;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+}
+
+template <typename Curve> class FixedBaseMsmTest : public ::testing::Test {
+  public:
+    using Fr = typename Curve::ScalarField;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    static constexpr size_t NUM_POINTS = 300;
+
+    static std::vector<AffineElement> point_table;
+
+    static void SetUpTestSuite()
+    {
+        point_table.resize(2 * NUM_POINTS);
+        for (size_t i = 0; i < NUM_POINTS; ++i) {
+            point_table[i] = AffineElement(Element::random_element(&engine));
+        }
+        generate_pippenger_point_table<Curve>(point_table.data(), point_table.data(), NUM_POINTS);
+    }
+
+    static AffineElement naive_msm(std::span<const Fr> scalars, size_t start_index)
+    {
+        Element result;
+        result.self_set_infinity();
+        for (size_t i = 0; i < scalars.size(); ++i) {
+            result += point_table[2 * (start_index + i)] * scalars[i];
+        }
+        return result;
+    }
+};
+
+template <typename Curve> std::vector<typename Curve::AffineElement> FixedBaseMsmTest<Curve>::point_table;
+
+using Curves = ::testing::Types<curve::BN254, curve::Grumpkin>;
+TYPED_TEST_SUITE(FixedBaseMsmTest, Curves);
+
+TYPED_TEST(FixedBaseMsmTest, Msm)
+{
+    using Fr = typename TypeParam::ScalarField;
+    using AffineElement = typename TypeParam::AffineElement;
+    constexpr size_t NUM_POINTS = TestFixture::NUM_POINTS;
+
+    // Include scalars whose signed digits carry all the way to the top window
+    std::vector<Fr> scalars(NUM_POINTS);
+    for (size_t i = 0; i < NUM_POINTS; ++i) {
+        scalars[i] = Fr::random_element(&engine);
+        if (i % 7 == 0) {
+            scalars[i] = 0;
+        } else if (i % 7 == 1) {
+            scalars[i] = -Fr::one();
+        } else if (i % 7 == 2) {
+            scalars[i] = Fr::one();
+        }
+    }
+
+    for (size_t bits_per_window : { FixedBaseMsm<TypeParam>::MIN_BITS_PER_WINDOW, size_t(11) }) {
+        FixedBaseMsm<TypeParam> fixed_base(TestFixture::point_table, NUM_POINTS, bits_per_window);
+        for (auto [start_index, size] : { std::pair<size_t, size_t>{ 0, NUM_POINTS }, { 17, 200 }, { 5, 1 } }) {
+            std::span<const Fr> slice(&scalars[start_index], size);
+            AffineElement result = fixed_base.msm(slice, start_index);
+            EXPECT_EQ(result, TestFixture::naive_msm(slice, start_index));
+        }
+    }
+}
+
+TYPED_TEST(FixedBaseMsmTest, AllZeroScalars)
+{
+    using Fr = typename TypeParam::ScalarField;
+    FixedBaseMsm<TypeParam> fixed_base(TestFixture::point_table, 16, FixedBaseMsm<TypeParam>::MIN_BITS_PER_WINDOW);
+    std::vector<Fr> scalars(16, Fr::zero());
+    EXPECT_TRUE(fixed_base.msm(scalars).is_point_at_infinity());
+}
+
+TYPED_TEST(FixedBaseMsmTest, OptimalBitsPerWindowRespectsBudget)
+{
+    using FixedBase = FixedBaseMsm<TypeParam>;
+    const size_t num_points = 1 << 16;
+    for (size_t budget : { size_t(1) << 28, size_t(1) << 30 }) {
+        const size_t bits_per_window = FixedBase::get_optimal_bits_per_window(num_points, budget);
+        ASSERT_NE(bits_per_window, 0);
+        EXPECT_LE(FixedBase::get_table_size(num_points, bits_per_window), budget);
+    }
+    // Even the widest windows need more memory than this
+    EXPECT_EQ(FixedBase::get_optimal_bits_per_window(num_points, 1 << 20), 0);
+}
@@ -26,7 +26,7 @@ template <class Flavor> class ExecutionTrace_ {
         uint32_t ram_rom_offset = 0;    // offset of the RAM/ROM block in the execution trace
         uint32_t pub_inputs_offset = 0; // offset of the public inputs block in the execution trace
 
-        TraceData(Builder& builder, ProvingKey& proving_key)
+        TraceData(Builder& builder, ProvingKey& proving_key, bool with_copy_cycles = true)
         {
 
             PROFILE_THIS_NAME("TraceData constructor");
@@ -57,7 +57,7 @@ template <class Flavor> class ExecutionTrace_ {
                     }
                 }
             }
-            {
+            if (with_copy_cycles) {
                 PROFILE_THIS_NAME("copy cycle initialization");
 
                 copy_cycles.resize(builder.variables.size());
@@ -75,8 +75,13 @@ template <class Flavor> class ExecutionTrace_ {
      *
      * @param builder
      * @param is_structured whether or not the trace is to be structured with a fixed block size
+     * @param populate_precomputed whether to construct the selector and sigma/id polynomials, which may be skipped
+     * when the proving key shares them with the key of a circuit of the same structure
      */
-    static void populate(Builder& builder, ProvingKey&, bool is_structured = false);
+    static void populate(Builder& builder,
+                         ProvingKey&,
+                         bool is_structured = false,
+                         bool populate_precomputed = true);
 
     /**
      * @brief Populate the public inputs block
@@ -110,11 +115,13 @@ template <class Flavor> class ExecutionTrace_ {
      * @param builder
      * @param dyadic_circuit_size
      * @param is_structured whether or not the trace is to be structured with a fixed block size
+     * @param populate_precomputed whether to construct the selector polynomials and copy cycles
      * @return TraceData
      */
     static TraceData construct_trace_data(Builder& builder,
                                           typename Flavor::ProvingKey& proving_key,
-                                          bool is_structured = false);
+                                          bool is_structured = false,
+                                          bool populate_precomputed = true);
 
     /**
      * @brief Construct and add the goblin ecc op wires to the proving key
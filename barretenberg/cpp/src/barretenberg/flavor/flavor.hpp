@@ -126,6 +126,10 @@ template <typename FF, typename CommitmentKey_> class ProvingKey_ {
     // Ranges over which the execution trace is "active"
     std::vector<std::pair<size_t, size_t>> active_block_ranges;
 
+    // Sorted, disjoint ranges of rows outside of which every relation is known to vanish identically (a superset of
+    // active_block_ranges that also covers e.g. lookup tables and databus columns). Empty if not known.
+    std::vector<std::pair<size_t, size_t>> active_row_ranges;
+
     ProvingKey_() = default;
     ProvingKey_(const size_t dyadic_circuit_size,
                 const size_t num_public_inputs,
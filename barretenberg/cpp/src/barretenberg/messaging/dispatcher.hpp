@@ -12,9 +12,15 @@ namespace bb::messaging {
 
 using message_handler = std::function<bool(msgpack::object&, msgpack::sbuffer&)>;
 
+/**
+ * @brief Routes messages to the handler registered for their type
+ *
+ * @details Message types are small consecutive integers, so the handlers are kept in a table indexed by type rather
+ * than looked up by hash on every message.
+ */
 class MessageDispatcher {
   private:
-    std::unordered_map<uint32_t, message_handler> messageHandlers;
+    std::vector<message_handler> messageHandlers;
 
   public:
     MessageDispatcher() = default;
@@ -24,17 +30,22 @@ class MessageDispatcher {
         bb::messaging::HeaderOnlyMessage header;
         obj.convert(header);
 
-        auto iter = messageHandlers.find(header.msgType);
-        if (iter == messageHandlers.end()) {
+        if (header.msgType >= messageHandlers.size() || !messageHandlers[header.msgType]) {
             throw std::runtime_error("No registered handler for message of type " + std::to_string(header.msgType));
         }
 
-        return (iter->second)(obj, buffer);
+        return messageHandlers[header.msgType](obj, buffer);
     }
 
     void registerTarget(uint32_t msgType, const message_handler& handler)
     {
-        messageHandlers.insert({ msgType, handler });
+        if (msgType >= messageHandlers.size()) {
+            messageHandlers.resize(msgType + 1);
+        }
+        // the first handler registered for a type is kept
+        if (!messageHandlers[msgType]) {
+            messageHandlers[msgType] = handler;
+        }
     }
 };
 
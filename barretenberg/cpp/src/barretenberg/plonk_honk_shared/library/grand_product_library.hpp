@@ -3,6 +3,7 @@
 #include "barretenberg/common/debug_log.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/zip_view.hpp"
+#include "barretenberg/ecc/fields/field_batch_ops.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include <typeinfo>
@@ -132,7 +133,7 @@ void compute_grand_product(typename Flavor::ProverPolynomials& full_polynomials,
         }
 
         // Final step: invert denominator
-        FF::batch_invert(std::span{ &denominator.data()[start], block_size });
+        field_batch_ops::batch_invert<FF>(std::span{ &denominator.data()[start], block_size });
     });
 
     DEBUG_LOG_ALL(numerator.coeffs());
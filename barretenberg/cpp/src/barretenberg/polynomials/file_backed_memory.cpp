@@ -0,0 +1,184 @@
+#include "file_backed_memory.hpp"
+#include "barretenberg/common/log.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#ifndef __wasm__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace bb::file_backed_memory {
+
+namespace {
+struct State {
+    std::mutex mutex;
+    bool enabled = false;
+    std::string scratch_dir;
+    size_t min_allocation_size = DEFAULT_MIN_ALLOCATION_SIZE;
+    // Live mappings, by start address
+    std::map<uintptr_t, size_t> mappings;
+    size_t allocated_bytes = 0;
+
+    State()
+    {
+        const char* scratch_dir_env = std::getenv("BB_POLYNOMIAL_SCRATCH_DIR");
+        if (scratch_dir_env != nullptr && *scratch_dir_env != '\0') {
+            enabled = true;
+            scratch_dir = scratch_dir_env;
+        }
+        const char* min_size_env = std::getenv("BB_POLYNOMIAL_SCRATCH_MIN_MB");
+        if (min_size_env != nullptr) {
+            min_allocation_size = std::stoull(min_size_env) << 20;
+        }
+    }
+};
+
+State& get_state()
+{
+    static State state;
+    return state;
+}
+
+#ifndef __wasm__
+/**
+ * @brief Apply a madvise advice to the pages of a file-backed mapping overlapping [data, data + num_bytes)
+ */
+void advise(const void* data, size_t num_bytes, int advice)
+{
+    if (num_bytes == 0) {
+        return;
+    }
+    State& state = get_state();
+    const auto address = reinterpret_cast<uintptr_t>(data);
+    uintptr_t mapping_end = 0;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        auto it = state.mappings.upper_bound(address);
+        if (it == state.mappings.begin()) {
+            return;
+        }
+        --it;
+        mapping_end = it->first + it->second;
+        if (address >= mapping_end) {
+            return;
+        }
+    }
+    // Mappings are page aligned, so rounding the start down to a page boundary stays within the mapping
+    const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const uintptr_t start = address & ~(page_size - 1);
+    const uintptr_t end = std::min(address + num_bytes, mapping_end);
+    madvise(reinterpret_cast<void*>(start), end - start, advice);
+}
+#endif
+} // namespace
+
+void enable(const std::string& scratch_dir, size_t min_allocation_size)
+{
+    State& state = get_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.enabled = true;
+    state.scratch_dir = scratch_dir;
+    state.min_allocation_size = min_allocation_size;
+}
+
+void disable()
+{
+    State& state = get_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.enabled = false;
+}
+
+std::shared_ptr<void> allocate([[maybe_unused]] size_t num_bytes)
+{
+#ifdef __wasm__
+    return nullptr;
+#else
+    State& state = get_state();
+    std::string scratch_dir;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (!state.enabled || num_bytes == 0 || num_bytes < state.min_allocation_size) {
+            return nullptr;
+        }
+        scratch_dir = state.scratch_dir;
+    }
+
+    std::string path = scratch_dir + "/bb_polynomial_XXXXXX";
+    std::vector<char> path_buffer(path.begin(), path.end());
+    path_buffer.push_back('\0');
+    const int fd = mkstemp(path_buffer.data());
+    if (fd < 0) {
+        vinfo("unable to create polynomial scratch file in ", scratch_dir, ", using regular memory");
+        return nullptr;
+    }
+    // The mapping keeps the file alive; unlinking it now ensures that it is removed however the process exits
+    unlink(path_buffer.data());
+    if (ftruncate(fd, static_cast<off_t>(num_bytes)) != 0) {
+        vinfo("unable to size polynomial scratch file in ", scratch_dir, ", using regular memory");
+        close(fd);
+        return nullptr;
+    }
+    void* mapping = mmap(nullptr, num_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.mappings.emplace(reinterpret_cast<uintptr_t>(mapping), num_bytes);
+        state.allocated_bytes += num_bytes;
+    }
+    return { mapping, [num_bytes](void* mapping) {
+                State& state = get_state();
+                {
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    state.mappings.erase(reinterpret_cast<uintptr_t>(mapping));
+                    state.allocated_bytes -= num_bytes;
+                }
+                munmap(mapping, num_bytes);
+            } };
+#endif
+}
+
+void prefetch([[maybe_unused]] const void* data, [[maybe_unused]] size_t num_bytes)
+{
+#ifndef __wasm__
+    advise(data, num_bytes, MADV_WILLNEED);
+#endif
+}
+
+void evict([[maybe_unused]] const void* data, [[maybe_unused]] size_t num_bytes)
+{
+#if !defined(__wasm__) && defined(MADV_COLD)
+    // Deactivating the pages costs nothing if memory is plentiful, unlike paging them out eagerly
+    advise(data, num_bytes, MADV_COLD);
+#endif
+}
+
+bool is_file_backed(const void* data)
+{
+    State& state = get_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    const auto address = reinterpret_cast<uintptr_t>(data);
+    auto it = state.mappings.upper_bound(address);
+    if (it == state.mappings.begin()) {
+        return false;
+    }
+    --it;
+    return address < it->first + it->second;
+}
+
+size_t get_allocated_bytes()
+{
+    State& state = get_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.allocated_bytes;
+}
+
+} // namespace bb::file_backed_memory
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string>
+
+/**
+ * @brief Out-of-core backing memory for large polynomials
+ *
+ * @details When enabled, polynomial allocations of at least min_allocation_size bytes are backed by memory mapped
+ * scratch files rather than by anonymous memory. The kernel can then write the pages of polynomials that are not in use
+ * back to their file and read them back in on access, so that the working set of a prover round, rather than the total
+ * size of the prover polynomials, has to fit in memory. The provers hint which polynomials a round is about to use
+ * (prefetch) and which ones it is done with for a while (evict), so that reads are issued ahead of the accesses and
+ * pages that will not be touched again soon are the first to be reclaimed.
+ *
+ * Enabled by setting BB_POLYNOMIAL_SCRATCH_DIR in the environment, with BB_POLYNOMIAL_SCRATCH_MIN_MB optionally
+ * overriding the threshold, or by calling enable(). Scratch files are unlinked as soon as they are created, so they
+ * never outlive the process. Not available in WASM, where allocate() always returns nullptr.
+ */
+namespace bb::file_backed_memory {
+
+constexpr size_t DEFAULT_MIN_ALLOCATION_SIZE = size_t(1) << 24;
+
+void enable(const std::string& scratch_dir, size_t min_allocation_size = DEFAULT_MIN_ALLOCATION_SIZE);
+void disable();
+
+/**
+ * @brief Allocate num_bytes of zeroed, page aligned, file-backed memory
+ * @return nullptr if file-backed memory is disabled, num_bytes is below the threshold or the scratch file could not be
+ * created; the caller should then fall back to regular memory
+ */
+std::shared_ptr<void> allocate(size_t num_bytes);
+
+/**
+ * @brief Hint that [data, data + num_bytes) is about to be used and should be read in ahead of the accesses. A no-op
+ * for memory that is not file-backed.
+ */
+void prefetch(const void* data, size_t num_bytes);
+
+/**
+ * @brief Hint that [data, data + num_bytes) will not be used for a while, making it the first to be written back and
+ * reclaimed under memory pressure. Contents are preserved. A no-op for memory that is not file-backed.
+ */
+void evict(const void* data, size_t num_bytes);
+
+bool is_file_backed(const void* data);
+
+// Total size of the live file-backed allocations
+size_t get_allocated_bytes();
+
+} // namespace bb::file_backed_memory
@@ -0,0 +1,87 @@
+#ifndef __wasm__
+#include "barretenberg/polynomials/file_backed_memory.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+
+#include <filesystem>
+#include <gtest/gtest.h>
+
+namespace {
+using FF = bb::fr;
+using Polynomial = bb::Polynomial<FF>;
+
+class FileBackedMemory : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        scratch_dir = std::filesystem::temp_directory_path() / "bb_file_backed_memory_test";
+        std::filesystem::create_directories(scratch_dir);
+        // Back anything of at least a page
+        bb::file_backed_memory::enable(scratch_dir.string(), 4096);
+    }
+
+    void TearDown() override
+    {
+        bb::file_backed_memory::disable();
+        std::filesystem::remove_all(scratch_dir);
+    }
+
+    std::filesystem::path scratch_dir;
+};
+} // namespace
+
+TEST_F(FileBackedMemory, LargePolynomialsAreFileBacked)
+{
+    const size_t allocated_before = bb::file_backed_memory::get_allocated_bytes();
+    {
+        Polynomial large(1 << 10);
+        Polynomial small(4);
+        EXPECT_TRUE(bb::file_backed_memory::is_file_backed(large.data()));
+        EXPECT_FALSE(bb::file_backed_memory::is_file_backed(small.data()));
+        EXPECT_GT(bb::file_backed_memory::get_allocated_bytes(), allocated_before);
+
+        // Freshly allocated scratch memory is zeroed, as for regular memory
+        for (size_t i = 0; i < large.size(); ++i) {
+            EXPECT_EQ(large[i], FF::zero());
+        }
+        // Scratch files are unlinked on creation
+        EXPECT_TRUE(std::filesystem::is_empty(scratch_dir));
+    }
+    EXPECT_EQ(bb::file_backed_memory::get_allocated_bytes(), allocated_before);
+}
+
+TEST_F(FileBackedMemory, HintsPreserveContents)
+{
+    const size_t n = 1 << 12;
+    auto poly = Polynomial::random(n);
+    auto other = Polynomial::random(n);
+    ASSERT_TRUE(bb::file_backed_memory::is_file_backed(poly.data()));
+
+    std::vector<FF> expected(n);
+    for (size_t i = 0; i < n; ++i) {
+        expected[i] = poly[i] + other[i];
+    }
+    poly.evict();
+    poly += other;
+    poly.evict();
+    poly.prefetch();
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(poly[i], expected[i]);
+    }
+
+    // Hints on a subrange of a mapping, or on memory that is not file-backed, are harmless
+    bb::file_backed_memory::evict(poly.data() + 3, sizeof(FF) * 5);
+    std::vector<FF> regular(n, FF::one());
+    bb::file_backed_memory::evict(regular.data(), sizeof(FF) * n);
+    bb::file_backed_memory::prefetch(regular.data(), sizeof(FF) * n);
+    EXPECT_EQ(regular[n - 1], FF::one());
+    EXPECT_EQ(poly[n - 1], expected[n - 1]);
+}
+
+TEST_F(FileBackedMemory, Disabled)
+{
+    bb::file_backed_memory::disable();
+    Polynomial poly(1 << 10);
+    EXPECT_FALSE(bb::file_backed_memory::is_file_backed(poly.data()));
+    EXPECT_EQ(bb::file_backed_memory::allocate(1 << 20), nullptr);
+}
+#endif
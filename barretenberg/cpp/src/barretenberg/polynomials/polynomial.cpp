@@ -2,6 +2,7 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/fields/field_batch_ops.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/polynomials/shared_shifted_virtual_zeroes_array.hpp"
@@ -265,9 +266,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator*=(const Fr scali
     parallel_for(num_threads, [&](size_t j) {
         const size_t offset = j * range_per_thread;
         const size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            data()[i] *= scaling_factor;
-        }
+        std::span<Fr> chunk{ data() + offset, end - offset };
+        field_batch_ops::scale<Fr>(chunk, scaling_factor, chunk);
     });
 
     return *this;
@@ -308,9 +308,9 @@ template <typename Fr> void Polynomial<Fr>::add_scaled(PolynomialSpan<const Fr>
     parallel_for(num_threads, [&](size_t j) {
         const size_t offset = j * range_per_thread + other.start_index;
         const size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            at(i) += scaling_factor * other[i];
-        }
+        field_batch_ops::add_scaled<Fr>(std::span<Fr>{ data() + (offset - start_index()), end - offset },
+                                        other.span.subspan(offset - other.start_index, end - offset),
+                                        scaling_factor);
     });
 }
 
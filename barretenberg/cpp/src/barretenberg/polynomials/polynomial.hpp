@@ -5,6 +5,7 @@
 #include "barretenberg/crypto/sha256/sha256.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/plonk_honk_shared/types/circuit_type.hpp"
+#include "barretenberg/polynomials/file_backed_memory.hpp"
 #include "barretenberg/polynomials/shared_shifted_virtual_zeroes_array.hpp"
 #include "evaluation_domain.hpp"
 #include "polynomial_arithmetic.hpp"
@@ -244,6 +245,13 @@ template <typename Fr> class Polynomial {
     Fr* data() { return coefficients_.data(); }
     const Fr* data() const { return coefficients_.data(); }
 
+    /**
+     * @brief Hint that the polynomial is about to be used (prefetch) or will not be used for a while (evict). These
+     * are no-ops unless the polynomial is file-backed, see file_backed_memory.hpp.
+     */
+    void prefetch() const { file_backed_memory::prefetch(data(), sizeof(Fr) * size()); }
+    void evict() const { file_backed_memory::evict(data(), sizeof(Fr) * size()); }
+
     /**
      * @brief Our mutable accessor, unlike operator[].
      * We abuse precedent a bit to differentiate at() and operator[] as mutable and immutable, respectively.
@@ -382,6 +390,11 @@ template <typename Fr> class Polynomial {
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
 template <typename Fr> std::shared_ptr<Fr[]> _allocate_aligned_memory(size_t n_elements)
 {
+    // Large polynomials may be backed by scratch files, if enabled
+    if (auto file_backed = file_backed_memory::allocate(sizeof(Fr) * n_elements)) {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        return std::static_pointer_cast<Fr[]>(file_backed);
+    }
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
     return std::static_pointer_cast<Fr[]>(get_mem_slab(sizeof(Fr) * n_elements));
 }
@@ -5,6 +5,7 @@
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "iterate_over_domain.hpp"
+#include <algorithm>
 #include <math.h>
 #include <memory.h>
 #include <memory>
@@ -168,6 +169,140 @@ void compute_multiplicative_subgroup(const size_t log2_subgroup_size,
     }
 }
 
+namespace {
+
+// The first rounds of the FFT only touch elements within blocks of this size, so we run all of them on one block
+// before moving on to the next, while the block is in the L2 cache. 2^12 elements of 32 bytes is 128KB.
+constexpr size_t FFT_BLOCK_SIZE = 1UL << 12;
+
+/**
+ * @brief Radix-2 butterflies of the FFT round with half-size m, for the butterflies [start, end) of the round
+ *
+ * @details The inputs are read from `src` and the outputs written to `out(index)`, which may alias `src`.
+ */
+template <typename Fr, typename Output>
+inline void radix_2_butterflies(
+    const Fr* src, const Output& out, const size_t m, const Fr* round_roots, const size_t start, const size_t end)
+{
+    const size_t block_mask = m - 1;
+    const size_t index_mask = ~block_mask;
+    for (size_t i = start; i < end; ++i) {
+        const size_t j = i & block_mask;
+        const size_t k = ((i & index_mask) << 1) + j;
+        const Fr temp = round_roots[j] * src[k + m];
+        out(k + m) = src[k] - temp;
+        out(k) = src[k] + temp;
+    }
+}
+
+/**
+ * @brief The FFT rounds with half-sizes m and 2m, fused into radix-4 butterflies, for the butterflies [start, end)
+ *
+ * @details A radix-4 butterfly reads the four elements k, k + m, k + 2m and k + 3m, applies to them the two radix-2
+ * butterflies of the round m and then the two of the round 2m, and writes them back. This costs the same four
+ * multiplications as the two radix-2 rounds, but makes one pass over the polynomial instead of two. The roots of both
+ * rounds are read linearly from their `round_roots` tables.
+ */
+template <typename Fr, typename Output>
+inline void radix_4_butterflies(const Fr* src,
+                                const Output& out,
+                                const size_t m,
+                                const Fr* round_roots,
+                                const Fr* next_round_roots,
+                                const size_t start,
+                                const size_t end)
+{
+    const size_t block_mask = m - 1;
+    const size_t index_mask = ~block_mask;
+    for (size_t i = start; i < end; ++i) {
+        const size_t j = i & block_mask;
+        const size_t k = ((i & index_mask) << 2) + j;
+        const Fr temp_1 = round_roots[j] * src[k + m];
+        const Fr temp_3 = round_roots[j] * src[k + 3 * m];
+        const Fr a0 = src[k] + temp_1;
+        const Fr a1 = src[k] - temp_1;
+        const Fr a2 = src[k + 2 * m] + temp_3;
+        const Fr a3 = src[k + 2 * m] - temp_3;
+        const Fr temp_2 = next_round_roots[j] * a2;
+        const Fr temp_4 = next_round_roots[j + m] * a3;
+        out(k) = a0 + temp_2;
+        out(k + 2 * m) = a0 - temp_2;
+        out(k + m) = a1 + temp_4;
+        out(k + 3 * m) = a1 - temp_4;
+    }
+}
+
+/**
+ * @brief Runs the FFT rounds with half-sizes 2, 4, ..., n/2 on `data`, which holds the output of the first round
+ *
+ * @details The rounds are run in two stages:
+ *  1. The rounds that stay within a block of FFT_BLOCK_SIZE elements (or of a thread's share of the domain, if that is
+ *     smaller) are run block by block, each thread taking the blocks of its share. Every block is loaded into the cache
+ *     once for all of these rounds, instead of once per round.
+ *  2. The remaining rounds span several blocks, and are run over the whole domain two at a time with radix-4
+ *     butterflies, plus a radix-2 round if their number is odd.
+ * The final round writes its output to `output(index)` instead of back into `data`, so that the multi-polynomial FFT
+ * can write straight into its polynomials.
+ */
+template <typename Fr, typename Output>
+void fft_butterfly_rounds(Fr* data,
+                          const Output& output,
+                          const EvaluationDomain<Fr>& domain,
+                          const std::vector<Fr*>& root_table)
+{
+    const size_t n = domain.size;
+    const auto in_place = [data](size_t index) -> Fr& { return data[index]; };
+    const auto get_round_roots = [&](size_t m) { return root_table[static_cast<size_t>(numeric::get_msb(m)) - 1]; };
+
+    // The blocked stage never runs the final round, so that its output always goes through `output`
+    const size_t block_size = std::min(FFT_BLOCK_SIZE, domain.thread_size);
+    const size_t blocked_rounds_end = std::min(block_size, n >> 1);
+    if (blocked_rounds_end > 2) {
+        parallel_for(domain.num_threads, [&](size_t j) {
+            const size_t thread_end = (j + 1) * domain.thread_size;
+            for (size_t block_start = j * domain.thread_size; block_start < thread_end; block_start += block_size) {
+                Fr* block = data + block_start;
+                const auto block_in_place = [block](size_t index) -> Fr& { return block[index]; };
+                size_t m = 2;
+                for (; 2 * m < blocked_rounds_end; m <<= 2) {
+                    radix_4_butterflies(
+                        block, block_in_place, m, get_round_roots(m), get_round_roots(2 * m), 0, block_size >> 2);
+                }
+                if (m < blocked_rounds_end) {
+                    radix_2_butterflies(block, block_in_place, m, get_round_roots(m), 0, block_size >> 1);
+                }
+            }
+        });
+    }
+
+    for (size_t m = std::max(blocked_rounds_end, size_t(2)); m < n;) {
+        if (2 * m < n) {
+            const bool is_final_round = (4 * m == n);
+            parallel_for(domain.num_threads, [&](size_t j) {
+                const size_t start = j * (domain.thread_size >> 2);
+                const size_t end = (j + 1) * (domain.thread_size >> 2);
+                const Fr* round_roots = get_round_roots(m);
+                const Fr* next_round_roots = get_round_roots(2 * m);
+                if (is_final_round) {
+                    radix_4_butterflies(data, output, m, round_roots, next_round_roots, start, end);
+                } else {
+                    radix_4_butterflies(data, in_place, m, round_roots, next_round_roots, start, end);
+                }
+            });
+            m <<= 2;
+        } else {
+            parallel_for(domain.num_threads, [&](size_t j) {
+                const size_t start = j * (domain.thread_size >> 1);
+                const size_t end = (j + 1) * (domain.thread_size >> 1);
+                radix_2_butterflies(data, output, m, get_round_roots(m), start, end);
+            });
+            m <<= 1;
+        }
+    }
+}
+
+} // namespace
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void fft_inner_parallel(std::vector<Fr*> coeffs,
@@ -209,6 +344,65 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
         }
     });
 
+    // hard code exception for when the domain size is tiny - there are no further rounds, so need to manually
+    // reduce + copy
+    if (domain.size <= 2) {
+        coeffs[0][0] = scratch_space[0];
+        coeffs[0][1] = scratch_space[1];
+        return;
+    }
+
+    const auto output = [&](size_t index) -> Fr& { return coeffs[index >> log2_poly_size][index & poly_mask]; };
+    fft_butterfly_rounds(scratch_space, output, domain, root_table);
+}
+
+/**
+ * @brief The radix-2 FFT, which runs one pass over the domain per round
+ *
+ * @details This is what fft_inner_parallel did before it fused its rounds into cache-blocked radix-4 passes. It is kept
+ * as the reference the faster FFT is tested and benchmarked against.
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_parallel_radix_2(std::vector<Fr*> coeffs,
+                                const EvaluationDomain<Fr>& domain,
+                                const Fr&,
+                                const std::vector<Fr*>& root_table)
+{
+    auto scratch_space_ptr = get_scratch_space<Fr>(domain.size);
+    auto scratch_space = scratch_space_ptr.get();
+
+    const size_t num_polys = coeffs.size();
+    ASSERT(is_power_of_two(num_polys));
+    const size_t poly_size = domain.size / num_polys;
+    ASSERT(is_power_of_two(poly_size));
+    const size_t poly_mask = poly_size - 1;
+    const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
+
+    parallel_for(domain.num_threads, [&](size_t j) {
+        Fr temp_1;
+        Fr temp_2;
+        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
+            uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
+            uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
+            __builtin_prefetch(&coeffs[next_index_1]);
+            __builtin_prefetch(&coeffs[next_index_2]);
+
+            uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
+            uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
+
+            size_t poly_idx_1 = swap_index_1 >> log2_poly_size;
+            size_t elem_idx_1 = swap_index_1 & poly_mask;
+            size_t poly_idx_2 = swap_index_2 >> log2_poly_size;
+            size_t elem_idx_2 = swap_index_2 & poly_mask;
+
+            Fr::__copy(coeffs[poly_idx_1][elem_idx_1], temp_1);
+            Fr::__copy(coeffs[poly_idx_2][elem_idx_2], temp_2);
+            scratch_space[i + 1] = temp_1 - temp_2;
+            scratch_space[i] = temp_1 + temp_2;
+        }
+    });
+
     // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
     // reduce + copy
     if (domain.size <= 2) {
@@ -320,75 +514,15 @@ void fft_inner_parallel(
         }
     });
 
-    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
+    // hard code exception for when the domain size is tiny - there are no further rounds, so need to manually
     // reduce + copy
     if (domain.size <= 2) {
         coeffs[0] = target[0];
         coeffs[1] = target[1];
+        return;
     }
 
-    // outer FFT loop
-    for (size_t m = 2; m < (domain.size); m <<= 1) {
-        parallel_for(domain.num_threads, [&](size_t j) {
-            Fr temp;
-
-            // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-            // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-            // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-            // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-            // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-            // directly access the roots of unity lookup table
-            const size_t start = j * (domain.thread_size >> 1);
-            const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-            // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-            // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-            //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-            //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-            //      roots of unity
-            // i.e. each successive FFT round will double the set of roots that we need to index.
-            // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-            // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-            // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-            // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-            // iterations, we loop back to the start.
-
-            // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-            // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-            // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-            // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-            // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-            // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-            const size_t block_mask = m - 1;
-
-            // The next problem to tackle, is we now need to efficiently index the polynomial element in
-            // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-            // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-            // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-            // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-            // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-            // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-            // block_mask)`
-            const size_t index_mask = ~block_mask;
-
-            // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-            // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-            // all 1).
-            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-            // Finally, we want to treat the final round differently from the others,
-            // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-            // `scratch_space`
-            for (size_t i = start; i < end; ++i) {
-                size_t k1 = (i & index_mask) << 1;
-                size_t j1 = i & block_mask;
-                temp = round_roots[j1] * target[k1 + j1 + m];
-                target[k1 + j1 + m] = target[k1 + j1] - temp;
-                target[k1 + j1] += temp;
-            }
-        });
-    }
+    fft_butterfly_rounds(target, [target](size_t index) -> Fr& { return target[index]; }, domain, root_table);
 }
 
 template <typename Fr>
@@ -538,7 +672,7 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void fft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel<Fr>(coeffs, domain.size, domain.root, domain.get_round_roots());
+    fft_inner_parallel(coeffs, domain, domain.root, domain.get_round_roots());
 }
 
 template <typename Fr>
@@ -1432,6 +1566,10 @@ template fr evaluate<fr>(const std::vector<fr*>, const fr&, const size_t);
 template void copy_polynomial<fr>(const fr*, fr*, size_t, size_t);
 template void fft_inner_serial<fr>(std::vector<fr*>, const size_t, const std::vector<fr*>&);
 template void fft_inner_parallel<fr>(std::vector<fr*>, const EvaluationDomain<fr>&, const fr&, const std::vector<fr*>&);
+template void fft_inner_parallel_radix_2<fr>(std::vector<fr*>,
+                                            const EvaluationDomain<fr>&,
+                                            const fr&,
+                                            const std::vector<fr*>&);
 template void fft<fr>(fr*, const EvaluationDomain<fr>&);
 template void fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 template void fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
@@ -37,6 +37,13 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
                         const EvaluationDomain<Fr>& domain,
                         const Fr&,
                         const std::vector<Fr*>& root_table);
+// The radix-2 FFT that fft_inner_parallel replaced, kept as a reference for tests and benchmarks
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_parallel_radix_2(std::vector<Fr*> coeffs,
+                                const EvaluationDomain<Fr>& domain,
+                                const Fr&,
+                                const std::vector<Fr*>& root_table);
 
 template <typename Fr>
     requires SupportsFFT<Fr>
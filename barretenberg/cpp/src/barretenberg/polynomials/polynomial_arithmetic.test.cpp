@@ -187,6 +187,55 @@ TEST(polynomials, split_polynomial_fft_ifft_consistency)
     }
 }
 
+/**
+ * @brief Check the cache-blocked radix-4 FFT against the radix-2 one, for domains whose number of rounds is odd and
+ * even, that fit in one FFT block and that span several, split into one or several polynomials
+ */
+TEST(polynomials, fft_matches_radix_2_fft)
+{
+    for (size_t log2_n = 2; log2_n <= 15; ++log2_n) {
+        const size_t n = 1UL << log2_n;
+        auto domain = evaluation_domain(n);
+        domain.compute_lookup_table();
+
+        for (const size_t num_poly : { 1UL, 4UL }) {
+            const size_t n_poly = n / num_poly;
+            std::vector<std::vector<fr>> result(num_poly);
+            std::vector<std::vector<fr>> expected(num_poly);
+            std::vector<fr*> result_ptrs;
+            std::vector<fr*> expected_ptrs;
+            for (size_t j = 0; j < num_poly; j++) {
+                for (size_t i = 0; i < n_poly; ++i) {
+                    result[j].emplace_back(fr::random_element());
+                }
+                expected[j] = result[j];
+                result_ptrs.push_back(result[j].data());
+                expected_ptrs.push_back(expected[j].data());
+            }
+
+            polynomial_arithmetic::fft(result_ptrs, domain);
+            polynomial_arithmetic::fft_inner_parallel_radix_2(
+                expected_ptrs, domain, domain.root, domain.get_round_roots());
+
+            for (size_t j = 0; j < num_poly; j++) {
+                EXPECT_EQ(result[j], expected[j]);
+            }
+        }
+
+        // The out of place FFT
+        std::vector<fr> coeffs(n);
+        std::vector<fr> target(n);
+        for (auto& coeff : coeffs) {
+            coeff = fr::random_element();
+        }
+        std::vector<fr> expected = coeffs;
+        polynomial_arithmetic::fft(coeffs.data(), target.data(), domain);
+        polynomial_arithmetic::fft_inner_parallel_radix_2(
+            { expected.data() }, domain, domain.root, domain.get_round_roots());
+        EXPECT_EQ(target, expected);
+    }
+}
+
 TEST(polynomials, fft_coset_ifft_consistency)
 {
     constexpr size_t n = 256;
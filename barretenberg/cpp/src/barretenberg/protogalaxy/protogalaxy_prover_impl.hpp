@@ -143,6 +143,19 @@ FoldingResult<typename DeciderProvingKeys::Flavor> ProtogalaxyProver_<DeciderPro
         }
     }
 
+    // The folded polynomials are nonzero wherever any of the folded keys is, so their active rows are the union of the
+    // active rows of the keys. If any key lacks that information, the accumulator is treated as fully active.
+    auto& accumulator_ranges = result.accumulator->proving_key.active_row_ranges;
+    for (size_t key_idx = 1; key_idx < DeciderProvingKeys::NUM && !accumulator_ranges.empty(); key_idx++) {
+        const auto& key_ranges = keys[key_idx]->proving_key.active_row_ranges;
+        if (key_ranges.empty()) {
+            accumulator_ranges.clear();
+        } else {
+            accumulator_ranges.insert(accumulator_ranges.end(), key_ranges.begin(), key_ranges.end());
+            accumulator_ranges = DeciderPK::merge_ranges(std::move(accumulator_ranges));
+        }
+    }
+
     // Evaluate the combined batching  α_i univariate at challenge to obtain next α_i and send it to the
     // verifier, where i ∈ {0,...,NUM_SUBRELATIONS - 1}
     for (auto [folded_alpha, key_alpha] : zip_view(result.accumulator->alphas, alphas)) {
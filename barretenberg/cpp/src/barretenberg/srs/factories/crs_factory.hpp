@@ -4,7 +4,10 @@
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/bn254/g2.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include <cstddef>
+#include <memory>
+#include <mutex>
 
 namespace bb::pairing {
 struct miller_lines;
@@ -25,6 +28,33 @@ template <typename Curve> class ProverCrs {
      */
     virtual std::span<typename Curve::AffineElement> get_monomial_points() = 0;
     virtual size_t get_monomial_size() const = 0;
+
+    /**
+     * @brief Returns the fixed-base MSM table of the monomial points, precomputed on first use
+     * @details The table is only built once a fixed-base MSM memory budget is configured (see
+     * scalar_multiplication::set_fixed_base_msm_memory_budget) and may cover only a prefix of the points. It lives as
+     * long as the CRS, so its cost is paid once per process rather than once per commitment.
+     * @return The table, or nullptr if fixed-base MSMs are disabled
+     */
+    std::shared_ptr<const scalar_multiplication::FixedBaseMsm<Curve>> get_fixed_base_msm()
+    {
+        const size_t memory_budget = scalar_multiplication::get_fixed_base_msm_memory_budget();
+        if (memory_budget == 0) {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> lock(fixed_base_msm_mutex);
+        if (!fixed_base_msm_initialized) {
+            fixed_base_msm = scalar_multiplication::FixedBaseMsm<Curve>::create_within_budget(
+                get_monomial_points(), get_monomial_size(), memory_budget);
+            fixed_base_msm_initialized = true;
+        }
+        return fixed_base_msm;
+    }
+
+  private:
+    std::mutex fixed_base_msm_mutex;
+    bool fixed_base_msm_initialized = false;
+    std::shared_ptr<const scalar_multiplication::FixedBaseMsm<Curve>> fixed_base_msm;
 };
 
 template <typename Curve> class VerifierCrs {
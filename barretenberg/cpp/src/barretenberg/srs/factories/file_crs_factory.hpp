@@ -1,5 +1,6 @@
 #pragma once
 #include "../io.hpp"
+#include "../point_table_cache.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
@@ -37,6 +38,9 @@ template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
      * @details Allocates space in monomials_ for 2 * num_points affine elements, populates the first num_points with
      * the raw SRS elements P_i, then overwrites the same memory with the 'pippenger point table' which contains the raw
      * elements P_i at even indices and the endomorphism point (\beta * P_i.x, -P_i.y) at odd indices.
+     * If the SRS directory holds a pippenger point table cache covering num_points, the table is mapped from it
+     * instead; otherwise the table is computed and written to the cache for later processes, replacing any cache that
+     * could not be used.
      *
      * @param num_points
      * @param path
@@ -47,10 +51,18 @@ template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
 
         PROFILE_THIS_NAME("FileProverCrs constructor");
 
+        const std::string cache_path = srs::PointTableCache<Curve>::get_cache_path(path);
+        monomials_ = srs::PointTableCache<Curve>::load(cache_path, path, num_points);
+        if (monomials_) {
+            vinfo("using cached ", Curve::name, " pippenger point table at ", cache_path);
+            return;
+        }
+
         monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
 
         srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
         scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+        srs::PointTableCache<Curve>::store(cache_path, monomials_.get(), num_points);
     };
 
     ~FileProverCrs()
@@ -42,8 +42,9 @@ class MemVerifierCrs : public VerifierCrs<curve::BN254> {
 namespace bb::srs::factories {
 
 MemBn254CrsFactory::MemBn254CrsFactory(std::vector<g1::affine_element> const& points,
-                                       g2::affine_element const& g2_point)
-    : prover_crs_(std::make_shared<MemProverCrs<curve::BN254>>(points))
+                                       g2::affine_element const& g2_point,
+                                       std::string const& point_table_cache_dir)
+    : prover_crs_(std::make_shared<MemProverCrs<curve::BN254>>(points, point_table_cache_dir))
 {
     auto g1_identity = g1::affine_element();
     if (!points.empty()) {
@@ -4,6 +4,7 @@
 #include "barretenberg/ecc/curves/bn254/g2.hpp"
 #include "crs_factory.hpp"
 #include <cstddef>
+#include <string>
 #include <utility>
 
 namespace bb::srs::factories {
@@ -11,11 +12,14 @@ namespace bb::srs::factories {
 /**
  * Create reference strings given pointers to in memory buffers.
  *
- * This class is currently only used with wasm and works exclusively with the BN254 CRS.
+ * This class is used with wasm and by the bb binary, and works exclusively with the BN254 CRS. If
+ * point_table_cache_dir is given, the pippenger point table of the prover CRS is cached there (see PointTableCache).
  */
 class MemBn254CrsFactory : public CrsFactory<curve::BN254> {
   public:
-    MemBn254CrsFactory(std::vector<g1::affine_element> const& points, g2::affine_element const& g2_point);
+    MemBn254CrsFactory(std::vector<g1::affine_element> const& points,
+                       g2::affine_element const& g2_point,
+                       std::string const& point_table_cache_dir = "");
     MemBn254CrsFactory(MemBn254CrsFactory&& other) = default;
 
     std::shared_ptr<bb::srs::factories::ProverCrs<curve::BN254>> get_prover_crs(size_t degree) override;
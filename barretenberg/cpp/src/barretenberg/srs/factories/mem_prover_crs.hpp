@@ -3,17 +3,40 @@
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/srs/factories/crs_factory.hpp"
+#include "barretenberg/srs/point_table_cache.hpp"
+
+#include <string>
 
 namespace bb::srs::factories {
 // Common to both Grumpkin and Bn254, and generally curves regardless of pairing-friendliness
 template <typename Curve> class MemProverCrs : public ProverCrs<Curve> {
   public:
-    MemProverCrs(std::vector<typename Curve::AffineElement> const& points)
+    /**
+     * @brief Construct a prover CRS populated with the pippenger point table of the given SRS points
+     * @details If point_table_cache_dir is given, the table is mapped from the pippenger point table cache in that
+     * directory when it covers the points, and is otherwise computed and written to the cache for later processes.
+     */
+    MemProverCrs(std::vector<typename Curve::AffineElement> const& points,
+                 std::string const& point_table_cache_dir = "")
         : num_points(points.size())
-        , monomials_(scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(points.size()))
     {
+        const bool use_cache = !point_table_cache_dir.empty() && num_points > 0;
+        const std::string cache_path =
+            use_cache ? srs::PointTableCache<Curve>::get_cache_path(point_table_cache_dir) : "";
+        if (use_cache) {
+            monomials_ = srs::PointTableCache<Curve>::load(cache_path, points, num_points);
+            if (monomials_) {
+                vinfo("using cached ", Curve::name, " pippenger point table at ", cache_path);
+                return;
+            }
+        }
+
+        monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
         std::copy(points.begin(), points.end(), monomials_.get());
         scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+        if (use_cache) {
+            srs::PointTableCache<Curve>::store(cache_path, monomials_.get(), num_points);
+        }
     }
 
     std::span<typename Curve::AffineElement> get_monomial_points() override
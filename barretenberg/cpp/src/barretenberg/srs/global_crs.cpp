@@ -13,9 +13,11 @@ std::shared_ptr<bb::srs::factories::CrsFactory<bb::curve::Grumpkin>> grumpkin_cr
 namespace bb::srs {
 
 // Initializes the crs using the memory buffers
-void init_crs_factory(std::vector<g1::affine_element> const& points, g2::affine_element const g2_point)
+void init_crs_factory(std::vector<g1::affine_element> const& points,
+                      g2::affine_element const g2_point,
+                      std::string const& point_table_cache_dir)
 {
-    crs_factory = std::make_shared<factories::MemBn254CrsFactory>(points, g2_point);
+    crs_factory = std::make_shared<factories::MemBn254CrsFactory>(points, g2_point, point_table_cache_dir);
 }
 
 // Initializes crs from a file path this we use in the entire codebase
@@ -8,9 +8,11 @@ namespace bb::srs {
 void init_crs_factory(std::string crs_path);
 void init_grumpkin_crs_factory(std::string crs_path);
 
-// Initializes the crs using memory buffers
+// Initializes the crs using memory buffers, caching the bn254 pippenger point table in point_table_cache_dir if given
 void init_grumpkin_crs_factory(std::vector<curve::Grumpkin::AffineElement> const& points);
-void init_crs_factory(std::vector<bb::g1::affine_element> const& points, bb::g2::affine_element const g2_point);
+void init_crs_factory(std::vector<bb::g1::affine_element> const& points,
+                      bb::g2::affine_element const g2_point,
+                      std::string const& point_table_cache_dir = "");
 
 std::shared_ptr<factories::CrsFactory<curve::BN254>> get_bn254_crs_factory();
 std::shared_ptr<factories::CrsFactory<curve::Grumpkin>> get_grumpkin_crs_factory();
@@ -0,0 +1,237 @@
+#pragma once
+#include "./io.hpp"
+#include "barretenberg/common/log.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bb::srs {
+
+/**
+ * @brief Header of a pippenger point table cache file
+ *
+ * @details A cache file holds the output of generate_pippenger_point_table for the first num_points SRS elements, i.e.
+ * 2 * num_points affine elements in Montgomery form, in native byte order, followed by a checksum of each chunk of
+ * chunk_size elements of the table:
+ *
+ * 00   | header (64 bytes)
+ * 40   | P_0, endo(P_0), P_1, endo(P_1), ...  (2 * num_points * sizeof(AffineElement) bytes)
+ * ..   | checksums of the chunks of the table (8 bytes each)
+ *
+ * The header is 64 bytes so that the table is suitably aligned when the file is mapped at a page boundary.
+ */
+struct PointTableCacheHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t element_size;
+    uint64_t num_points;
+    uint64_t chunk_size;
+    uint8_t reserved[32];
+};
+static_assert(sizeof(PointTableCacheHeader) == 64);
+
+/**
+ * @brief Memory mapped on-disk cache of the pippenger point table of an SRS
+ * @details Expanding the SRS into a pippenger point table costs several seconds for large SRS sizes and each process
+ * holds its own private copy. A cache file written once can instead be mapped read-only by every prover process on a
+ * host, which then share a single copy through the page cache. Any mismatch between the cache and the transcript (bad
+ * version, truncated file, failed checksum, different SRS) results in the cache being ignored. Only the chunks of the
+ * table that cover the requested points are checksummed on load, so the rest of the mapping is never paged in.
+ */
+template <typename Curve> class PointTableCache {
+    using AffineElement = typename Curve::AffineElement;
+
+  public:
+    static constexpr uint64_t MAGIC = 0x4548434154504242; // "BBPTACHE" in little endian
+    static constexpr uint32_t VERSION = 2;
+    // The number of table elements each checksum covers (4MB of BN254 points)
+    static constexpr uint64_t CHUNK_SIZE = 1UL << 16;
+
+    /**
+     * @brief The cache file of the SRS in srs_dir. It lives in srs_dir itself, unless the BB_POINT_TABLE_CACHE_DIR
+     * environment variable names another directory (e.g. so that test runs do not write to the SRS directory).
+     */
+    static std::string get_cache_path(std::string const& srs_dir)
+    {
+        const char* cache_dir = std::getenv("BB_POINT_TABLE_CACHE_DIR");
+        const std::string dir = cache_dir != nullptr && *cache_dir != '\0' ? std::string(cache_dir) : srs_dir;
+        return format(dir, "/pippenger_point_table_", Curve::name, ".dat");
+    }
+
+    /**
+     * @brief A cheap 64 bit checksum over the raw bytes of the table. Four independent lanes keep the multiplies from
+     * serialising, so this runs close to memory bandwidth.
+     */
+    static uint64_t compute_checksum(const AffineElement* table, size_t num_elements)
+    {
+        constexpr uint64_t PRIME = 0x9E3779B97F4A7C15ULL;
+        const auto* words = reinterpret_cast<const uint64_t*>(table);
+        const size_t num_words = num_elements * sizeof(AffineElement) / sizeof(uint64_t);
+        uint64_t lanes[4] = { 1, 2, 3, 4 };
+        size_t i = 0;
+        for (; i + 4 <= num_words; i += 4) {
+            for (size_t j = 0; j < 4; ++j) {
+                lanes[j] = (lanes[j] ^ words[i + j]) * PRIME;
+            }
+        }
+        for (; i < num_words; ++i) {
+            lanes[0] = (lanes[0] ^ words[i]) * PRIME;
+        }
+        return (lanes[0] ^ (lanes[1] << 1) ^ (lanes[2] << 2) ^ (lanes[3] << 3)) * PRIME;
+    }
+
+    /**
+     * @brief Map a cached point table of the SRS transcript in srs_dir, see the overload taking the SRS points
+     */
+    static std::shared_ptr<AffineElement[]> load([[maybe_unused]] std::string const& cache_path,
+                                                 [[maybe_unused]] std::string const& srs_dir,
+                                                 [[maybe_unused]] size_t num_points)
+    {
+#ifdef __wasm__
+        return nullptr;
+#else
+        AffineElement srs_points[2];
+        const size_t num_to_check = std::min(num_points, size_t(2));
+        IO<Curve>::read_transcript_g1(srs_points, num_to_check, srs_dir);
+        return load(cache_path, std::span<const AffineElement>(srs_points, num_to_check), num_points);
+#endif
+    }
+
+    /**
+     * @brief Map a cached point table holding at least num_points SRS elements
+     *
+     * @param cache_path the cache file
+     * @param srs_points the SRS the table must have been generated from, only its first two points are compared
+     * @return The table, backed by a read-only shared mapping, or nullptr if there is no usable cache.
+     */
+    static std::shared_ptr<AffineElement[]> load([[maybe_unused]] std::string const& cache_path,
+                                                 [[maybe_unused]] std::span<const AffineElement> srs_points,
+                                                 [[maybe_unused]] size_t num_points)
+    {
+#ifdef __wasm__
+        return nullptr;
+#else
+        int fd = open(cache_path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return nullptr;
+        }
+        PointTableCacheHeader header;
+        struct stat st;
+        const bool read_header = ::read(fd, &header, sizeof(header)) == static_cast<ssize_t>(sizeof(header));
+        if (!read_header || fstat(fd, &st) != 0 || header.magic != MAGIC || header.version != VERSION ||
+            header.element_size != sizeof(AffineElement) || header.chunk_size != CHUNK_SIZE ||
+            header.num_points < num_points || static_cast<size_t>(st.st_size) != get_file_size(header.num_points)) {
+            vinfo("ignoring invalid pippenger point table cache at ", cache_path);
+            close(fd);
+            return nullptr;
+        }
+        const size_t file_size = get_file_size(header.num_points);
+        void* mapping = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+        // The mapping holds its own reference to the file.
+        close(fd);
+        if (mapping == MAP_FAILED) {
+            return nullptr;
+        }
+        auto* table = reinterpret_cast<AffineElement*>(static_cast<uint8_t*>(mapping) + sizeof(header));
+        std::shared_ptr<AffineElement[]> result(table, [mapping, file_size](AffineElement*) {
+            munmap(mapping, file_size);
+        });
+
+        // Only the chunks covering the points used are checked, the others may never be read
+        const size_t num_elements = 2 * header.num_points;
+        const auto* checksums = reinterpret_cast<const uint64_t*>(table + num_elements);
+        for (size_t chunk = 0; chunk * CHUNK_SIZE < 2 * num_points; ++chunk) {
+            const size_t start = chunk * CHUNK_SIZE;
+            if (compute_checksum(table + start, std::min<size_t>(CHUNK_SIZE, num_elements - start)) !=
+                checksums[chunk]) {
+                vinfo("ignoring pippenger point table cache with bad checksum at ", cache_path);
+                return nullptr;
+            }
+        }
+        // Guard against a cache generated from a different SRS: the even entries of the table are the SRS points.
+        const size_t num_to_check = std::min({ num_points, srs_points.size(), size_t(2) });
+        for (size_t i = 0; i < num_to_check; ++i) {
+            if (table[2 * i] != srs_points[i]) {
+                vinfo("ignoring pippenger point table cache for a different SRS at ", cache_path);
+                return nullptr;
+            }
+        }
+        return result;
+#endif
+    }
+
+    /**
+     * @brief Write a point table of num_points SRS elements to the cache, replacing whatever the cache held
+     * @details Meant to be called once load() has failed, so an existing file is either too small or invalid (bad
+     * checksum, different SRS) and must not be kept, or it would be rejected again by every later process.
+     * Best effort: failures (e.g. a read-only SRS directory) are logged and otherwise ignored. The file is written
+     * under a temporary name and renamed into place, so concurrent readers never observe a partial file.
+     */
+    static void store([[maybe_unused]] std::string const& cache_path,
+                      [[maybe_unused]] const AffineElement* table,
+                      [[maybe_unused]] size_t num_points)
+    {
+#ifndef __wasm__
+        PointTableCacheHeader header{};
+        header.magic = MAGIC;
+        header.version = VERSION;
+        header.element_size = sizeof(AffineElement);
+        header.num_points = num_points;
+        header.chunk_size = CHUNK_SIZE;
+        const size_t num_elements = 2 * num_points;
+        std::vector<uint64_t> checksums(get_num_chunks(num_points));
+        for (size_t chunk = 0; chunk < checksums.size(); ++chunk) {
+            const size_t start = chunk * CHUNK_SIZE;
+            checksums[chunk] = compute_checksum(table + start, std::min<size_t>(CHUNK_SIZE, num_elements - start));
+        }
+
+        std::error_code error;
+        std::filesystem::create_directories(std::filesystem::path(cache_path).parent_path(), error);
+        const std::string tmp_path = format(cache_path, ".tmp.", std::to_string(getpid()));
+        {
+            std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(table),
+                       static_cast<std::streamsize>(num_elements * sizeof(AffineElement)));
+            file.write(reinterpret_cast<const char*>(checksums.data()),
+                       static_cast<std::streamsize>(checksums.size() * sizeof(uint64_t)));
+            if (!file) {
+                vinfo("unable to write pippenger point table cache to ", cache_path);
+                file.close();
+                std::filesystem::remove(tmp_path, error);
+                return;
+            }
+        }
+        std::filesystem::rename(tmp_path, cache_path, error);
+        if (error) {
+            vinfo("unable to write pippenger point table cache to ", cache_path, ": ", error.message());
+            std::filesystem::remove(tmp_path, error);
+        }
+#endif
+    }
+
+  private:
+    static size_t get_num_chunks(size_t num_points) { return (2 * num_points + CHUNK_SIZE - 1) / CHUNK_SIZE; }
+
+    static size_t get_file_size(size_t num_points)
+    {
+        return sizeof(PointTableCacheHeader) + 2 * num_points * sizeof(AffineElement) +
+               get_num_chunks(num_points) * sizeof(uint64_t);
+    }
+};
+
+} // namespace bb::srs
@@ -0,0 +1,167 @@
+#include "point_table_cache.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/srs/factories/file_crs_factory.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <optional>
+
+using namespace bb;
+
+namespace {
+using Curve = curve::BN254;
+using AffineElement = Curve::AffineElement;
+using Cache = srs::PointTableCache<Curve>;
+
+const std::string SRS_PATH = "../srs_db/ignition";
+
+class PointTableCacheTest : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        cache_path = (std::filesystem::temp_directory_path() /
+                      ("pippenger_point_table_test_" + std::to_string(getpid()) + ".dat"))
+                         .string();
+    }
+
+    void TearDown() override { std::filesystem::remove(cache_path); }
+
+    static std::shared_ptr<AffineElement[]> compute_table(size_t num_points)
+    {
+        auto table = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+        srs::IO<Curve>::read_transcript_g1(table.get(), num_points, SRS_PATH);
+        scalar_multiplication::generate_pippenger_point_table<Curve>(table.get(), table.get(), num_points);
+        return table;
+    }
+
+    // Flip a bit of the byte at offset in the file
+    static void flip_byte(std::string const& path, size_t offset)
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        char byte = 0;
+        file.seekg(static_cast<std::streamoff>(offset));
+        file.read(&byte, 1);
+        byte ^= 1;
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.write(&byte, 1);
+    }
+
+    std::string cache_path;
+};
+} // namespace
+
+TEST_F(PointTableCacheTest, StoreAndLoad)
+{
+    const size_t num_points = 1024;
+    auto expected = compute_table(num_points);
+    Cache::store(cache_path, expected.get(), num_points);
+
+    // A cache can serve any prefix of the SRS it was written for
+    for (size_t n : { num_points, num_points / 2 }) {
+        auto loaded = Cache::load(cache_path, SRS_PATH, n);
+        ASSERT_NE(loaded, nullptr);
+        for (size_t i = 0; i < 2 * n; ++i) {
+            EXPECT_EQ(loaded.get()[i], expected.get()[i]);
+        }
+    }
+
+    // ...but not more points than it holds
+    EXPECT_EQ(Cache::load(cache_path, SRS_PATH, num_points + 1), nullptr);
+}
+
+TEST_F(PointTableCacheTest, RejectsCorruptedCache)
+{
+    const size_t num_points = 256;
+    auto table = compute_table(num_points);
+    Cache::store(cache_path, table.get(), num_points);
+
+    // Flip a byte in the middle of the table
+    flip_byte(cache_path, sizeof(srs::PointTableCacheHeader) + 100 * sizeof(AffineElement));
+    EXPECT_EQ(Cache::load(cache_path, SRS_PATH, num_points), nullptr);
+
+    // Truncated file
+    std::filesystem::resize_file(cache_path, sizeof(srs::PointTableCacheHeader) + 10);
+    EXPECT_EQ(Cache::load(cache_path, SRS_PATH, num_points), nullptr);
+}
+
+TEST_F(PointTableCacheTest, OnlyChecksChunksOfPointsUsed)
+{
+    // Two chunks of table elements
+    const size_t num_points = Cache::CHUNK_SIZE;
+    auto table = compute_table(num_points);
+    Cache::store(cache_path, table.get(), num_points);
+
+    // Flip a byte in the second chunk
+    flip_byte(cache_path, sizeof(srs::PointTableCacheHeader) + (Cache::CHUNK_SIZE + 100) * sizeof(AffineElement));
+    // The first half of the points only use the first chunk
+    EXPECT_NE(Cache::load(cache_path, SRS_PATH, num_points / 2), nullptr);
+    EXPECT_EQ(Cache::load(cache_path, SRS_PATH, num_points), nullptr);
+}
+
+TEST_F(PointTableCacheTest, CacheDirectoryCanBeOverridden)
+{
+    const char* previous = std::getenv("BB_POINT_TABLE_CACHE_DIR");
+    const std::optional<std::string> previous_dir =
+        previous != nullptr ? std::optional<std::string>(previous) : std::nullopt;
+
+    const std::string cache_dir = std::filesystem::path(cache_path).parent_path().string();
+    setenv("BB_POINT_TABLE_CACHE_DIR", cache_dir.c_str(), 1);
+    EXPECT_EQ(Cache::get_cache_path(SRS_PATH), cache_dir + "/pippenger_point_table_" + Curve::name + ".dat");
+    unsetenv("BB_POINT_TABLE_CACHE_DIR");
+    EXPECT_EQ(Cache::get_cache_path(SRS_PATH), SRS_PATH + "/pippenger_point_table_" + Curve::name + ".dat");
+
+    if (previous_dir.has_value()) {
+        setenv("BB_POINT_TABLE_CACHE_DIR", previous_dir->c_str(), 1);
+    }
+}
+
+TEST_F(PointTableCacheTest, RejectsCacheOfDifferentSrs)
+{
+    const size_t num_points = 16;
+    auto table = compute_table(num_points);
+    std::swap(table.get()[0], table.get()[2]);
+    Cache::store(cache_path, table.get(), num_points);
+
+    EXPECT_EQ(Cache::load(cache_path, SRS_PATH, num_points), nullptr);
+}
+
+TEST_F(PointTableCacheTest, RecomputedTableReplacesInvalidCache)
+{
+    const size_t num_points = 256;
+    const std::string cache_dir = cache_path + ".dir";
+    const char* previous = std::getenv("BB_POINT_TABLE_CACHE_DIR");
+    const std::optional<std::string> previous_dir =
+        previous != nullptr ? std::optional<std::string>(previous) : std::nullopt;
+    setenv("BB_POINT_TABLE_CACHE_DIR", cache_dir.c_str(), 1);
+    const std::string crs_cache_path = Cache::get_cache_path(SRS_PATH);
+
+    // The first prover CRS writes the cache
+    {
+        srs::factories::FileProverCrs<Curve> first_crs(num_points, SRS_PATH);
+    }
+    ASSERT_NE(Cache::load(crs_cache_path, SRS_PATH, num_points), nullptr);
+
+    // Flip a byte of the table
+    flip_byte(crs_cache_path, sizeof(srs::PointTableCacheHeader) + 100 * sizeof(AffineElement));
+    ASSERT_EQ(Cache::load(crs_cache_path, SRS_PATH, num_points), nullptr);
+
+    // The next one recomputes the table and overwrites the corrupted cache with it
+    srs::factories::FileProverCrs<Curve> crs(num_points, SRS_PATH);
+    auto expected = compute_table(num_points);
+    auto loaded = Cache::load(crs_cache_path, SRS_PATH, num_points);
+    ASSERT_NE(loaded, nullptr);
+    for (size_t i = 0; i < 2 * num_points; ++i) {
+        EXPECT_EQ(loaded.get()[i], expected.get()[i]);
+        EXPECT_EQ(crs.get_monomial_points()[i], expected.get()[i]);
+    }
+
+    std::filesystem::remove_all(cache_dir);
+    if (previous_dir.has_value()) {
+        setenv("BB_POINT_TABLE_CACHE_DIR", previous_dir->c_str(), 1);
+    } else {
+        unsetenv("BB_POINT_TABLE_CACHE_DIR");
+    }
+}
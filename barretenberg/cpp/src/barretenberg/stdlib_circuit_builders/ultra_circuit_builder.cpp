@@ -6,6 +6,7 @@
  *
  */
 #include "ultra_circuit_builder.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/crypto/poseidon2/poseidon2_params.hpp"
 #include <barretenberg/plonk/proof_system/constants.hpp>
 #include <unordered_map>
@@ -45,10 +46,22 @@ void UltraCircuitBuilder_<Arithmetization>::finalize_circuit(const bool ensure_n
         if (ensure_nonzero) {
             add_gates_to_ensure_all_polys_are_non_zero();
         }
+        // A circuit with the same structure as one finalized before only needs the values of the variables that
+        // finalization creates to be computed (see CircuitTemplate)
+        if (circuit_template_state.replay && finalize_from_circuit_template(*circuit_template_state.replay)) {
+            circuit_finalized = true;
+            return;
+        }
+        if (circuit_template_state.record) {
+            begin_circuit_template_recording();
+        }
         process_non_native_field_multiplications();
         process_ROM_arrays();
         process_RAM_arrays();
         process_range_lists();
+        if (circuit_template_state.recording) {
+            end_circuit_template_recording();
+        }
         circuit_finalized = true;
     } else {
         // Gates added after first call to finalize will not be processed since finalization is only performed once
@@ -1050,6 +1063,13 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
     for (size_t i = 0; i < padding; ++i) {
         indices.emplace_back(this->zero_idx);
     }
+    if (circuit_template_state.recording) {
+        circuit_template_state.recording->witness_program.push_back({
+            .type = CircuitTemplate::WitnessOp::Type::SORTED_RANGE_LIST,
+            .output_offset = static_cast<uint32_t>(this->variables.size()),
+            .variable_indices = list.variable_indices,
+        });
+    }
     for (const auto sorted_value : sorted_list) {
         const uint32_t index = this->add_variable(sorted_value);
         assign_tag(index, list.tau_tag);
@@ -2591,6 +2611,14 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
         }
     }
 
+    typename CircuitTemplate::WitnessOp* witness_op = nullptr;
+    if (circuit_template_state.recording) {
+        witness_op = &circuit_template_state.recording->witness_program.emplace_back();
+        witness_op->type = CircuitTemplate::WitnessOp::Type::SORTED_ROM_RECORDS;
+        witness_op->output_offset = static_cast<uint32_t>(this->variables.size());
+        witness_op->rom_records = rom_array.records;
+    }
+
 #ifdef NO_TBB
     std::sort(rom_array.records.begin(), rom_array.records.end());
 #else
@@ -2613,6 +2641,9 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
             .gate_index = 0,
         };
         create_sorted_ROM_gate(sorted_record);
+        if (witness_op != nullptr) {
+            witness_op->sorted_gate_indices.push_back(static_cast<uint32_t>(sorted_record.gate_index));
+        }
 
         assign_tag(record.record_witness, read_tag);
         assign_tag(sorted_record.record_witness, sorted_list_tag);
@@ -2683,6 +2714,14 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
         }
     }
 
+    typename CircuitTemplate::WitnessOp* witness_op = nullptr;
+    if (circuit_template_state.recording) {
+        witness_op = &circuit_template_state.recording->witness_program.emplace_back();
+        witness_op->type = CircuitTemplate::WitnessOp::Type::SORTED_RAM_RECORDS;
+        witness_op->output_offset = static_cast<uint32_t>(this->variables.size());
+        witness_op->ram_records = ram_array.records;
+    }
+
 #ifdef NO_TBB
     std::sort(ram_array.records.begin(), ram_array.records.end());
 #else
@@ -2723,6 +2762,9 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
             // Only need to check the index value = RAM array size - 1.
             create_final_sorted_RAM_gate(sorted_record, ram_array.state.size());
         }
+        if (witness_op != nullptr) {
+            witness_op->sorted_gate_indices.push_back(static_cast<uint32_t>(sorted_record.gate_index));
+        }
 
         // Assign record/sorted records to tags that we will perform set equivalence checks on
         assign_tag(record.record_witness, access_tag);
@@ -2757,6 +2799,9 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
     // Step 2: Create gates that validate correctness of RAM timestamps
 
     std::vector<uint32_t> timestamp_deltas;
+    if (witness_op != nullptr) {
+        witness_op->timestamp_delta_offset = static_cast<uint32_t>(this->variables.size());
+    }
     for (size_t i = 0; i < sorted_ram_records.size() - 1; ++i) {
         // create_RAM_timestamp_gate(sorted_records[i], sorted_records[i + 1])
         const auto& current = sorted_ram_records[i];
@@ -2808,6 +2853,289 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
     }
 }
 
+/**
+ * @brief Start recording a CircuitTemplate of the circuit, which is about to be finalized
+ * @details Captures the unfinalized circuit; the steps of the witness program are recorded by the processing of the
+ * range lists and ROM/RAM arrays as they create the variables concerned.
+ */
+template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::begin_circuit_template_recording()
+{
+    auto recording = std::make_shared<CircuitTemplate>();
+    for (auto& block : blocks.get()) {
+        auto& block_wires = recording->unfinalized_block_wires.emplace_back();
+        for (auto& wire : block.wires) {
+            block_wires.emplace_back(wire.begin(), wire.end());
+        }
+    }
+    recording->public_inputs = this->public_inputs;
+    recording->unfinalized_real_variable_index = this->real_variable_index;
+    recording->unfinalized_range_lists = range_lists;
+    recording->unfinalized_rom_arrays = rom_arrays;
+    recording->unfinalized_ram_arrays = ram_arrays;
+    recording->unfinalized_non_native_field_multiplications = cached_partial_non_native_field_multiplications;
+    recording->num_unfinalized_gates = this->num_gates;
+    recording->num_unfinalized_memory_read_records = memory_read_records.size();
+    recording->num_unfinalized_memory_write_records = memory_write_records.size();
+    circuit_template_state.recording = std::move(recording);
+}
+
+/**
+ * @brief Complete the CircuitTemplate being recorded with what finalization added to the circuit
+ */
+template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::end_circuit_template_recording()
+{
+    auto& recording = *circuit_template_state.recording;
+    size_t block_idx = 0;
+    for (auto& block : blocks.get()) {
+        const auto start = static_cast<std::ptrdiff_t>(recording.unfinalized_block_wires[block_idx++][0].size());
+        auto& gates = recording.finalization_gates.emplace_back();
+        for (auto& wire : block.wires) {
+            gates.wires.emplace_back(wire.begin() + start, wire.end());
+        }
+        for (auto& selector : block.selectors) {
+            gates.selectors.emplace_back(selector.begin() + start, selector.end());
+        }
+    }
+    const auto num_unfinalized_variables =
+        static_cast<std::ptrdiff_t>(recording.unfinalized_real_variable_index.size());
+    recording.finalization_variables.assign(this->variables.begin() + num_unfinalized_variables,
+                                            this->variables.end());
+    recording.next_var_index = this->next_var_index;
+    recording.prev_var_index = this->prev_var_index;
+    recording.real_variable_index = this->real_variable_index;
+    recording.real_variable_tags = this->real_variable_tags;
+    recording.tau = this->tau;
+    recording.current_tag = this->current_tag;
+    recording.num_gates = this->num_gates;
+    recording.constant_variable_indices = constant_variable_indices;
+    recording.range_lists = range_lists;
+    recording.cached_partial_non_native_field_multiplications = cached_partial_non_native_field_multiplications;
+    circuit_template_state.recorded = std::move(circuit_template_state.recording);
+}
+
+/**
+ * @brief Check whether the unfinalized circuit has the structure of the one a template was recorded from
+ * @details The indices of ROM/RAM accesses and the contents of RAM arrays depend on the witness and are not compared.
+ */
+template <typename Arithmetization>
+bool UltraCircuitBuilder_<Arithmetization>::matches_circuit_template(const CircuitTemplate& circuit_template)
+{
+    if (this->num_gates != circuit_template.num_unfinalized_gates ||
+        this->variables.size() != circuit_template.unfinalized_real_variable_index.size() ||
+        memory_read_records.size() != circuit_template.num_unfinalized_memory_read_records ||
+        memory_write_records.size() != circuit_template.num_unfinalized_memory_write_records ||
+        this->public_inputs != circuit_template.public_inputs ||
+        this->real_variable_index != circuit_template.unfinalized_real_variable_index ||
+        range_lists != circuit_template.unfinalized_range_lists ||
+        cached_partial_non_native_field_multiplications !=
+            circuit_template.unfinalized_non_native_field_multiplications) {
+        return false;
+    }
+
+    size_t block_idx = 0;
+    for (auto& block : blocks.get()) {
+        if (block_idx == circuit_template.unfinalized_block_wires.size()) {
+            return false;
+        }
+        const auto& block_wires = circuit_template.unfinalized_block_wires[block_idx++];
+        for (size_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+            const auto& wire = block.wires[wire_idx];
+            if (!std::equal(wire.begin(), wire.end(), block_wires[wire_idx].begin(), block_wires[wire_idx].end())) {
+                return false;
+            }
+        }
+    }
+
+    const auto same_rom_record = [](const RomRecord& lhs, const RomRecord& rhs) {
+        return lhs.index_witness == rhs.index_witness && lhs.value_column1_witness == rhs.value_column1_witness &&
+               lhs.value_column2_witness == rhs.value_column2_witness && lhs.record_witness == rhs.record_witness &&
+               lhs.gate_index == rhs.gate_index;
+    };
+    if (rom_arrays.size() != circuit_template.unfinalized_rom_arrays.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < rom_arrays.size(); ++i) {
+        const auto& rom_array = rom_arrays[i];
+        const auto& template_array = circuit_template.unfinalized_rom_arrays[i];
+        if (rom_array.state != template_array.state ||
+            !std::equal(rom_array.records.begin(),
+                        rom_array.records.end(),
+                        template_array.records.begin(),
+                        template_array.records.end(),
+                        same_rom_record)) {
+            return false;
+        }
+    }
+
+    const auto same_ram_record = [](const RamRecord& lhs, const RamRecord& rhs) {
+        return lhs.index_witness == rhs.index_witness && lhs.timestamp_witness == rhs.timestamp_witness &&
+               lhs.value_witness == rhs.value_witness && lhs.timestamp == rhs.timestamp &&
+               lhs.access_type == rhs.access_type && lhs.record_witness == rhs.record_witness &&
+               lhs.gate_index == rhs.gate_index;
+    };
+    // The cells left uninitialized, which finalization initializes, must be the same
+    const auto same_initialized_cells = [](const RamTranscript& lhs, const RamTranscript& rhs) {
+        return std::equal(lhs.state.begin(),
+                          lhs.state.end(),
+                          rhs.state.begin(),
+                          rhs.state.end(),
+                          [](const uint32_t lhs_cell, const uint32_t rhs_cell) {
+                              return (lhs_cell == UNINITIALIZED_MEMORY_RECORD) ==
+                                     (rhs_cell == UNINITIALIZED_MEMORY_RECORD);
+                          });
+    };
+    if (ram_arrays.size() != circuit_template.unfinalized_ram_arrays.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < ram_arrays.size(); ++i) {
+        const auto& ram_array = ram_arrays[i];
+        const auto& template_array = circuit_template.unfinalized_ram_arrays[i];
+        if (ram_array.access_count != template_array.access_count ||
+            !same_initialized_cells(ram_array, template_array) ||
+            !std::equal(ram_array.records.begin(),
+                        ram_array.records.end(),
+                        template_array.records.begin(),
+                        template_array.records.end(),
+                        same_ram_record)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Finalize the circuit by appending the gates recorded in a template and running its witness program
+ *
+ * @return false if the circuit does not match the template, in which case it is left unchanged
+ */
+template <typename Arithmetization>
+bool UltraCircuitBuilder_<Arithmetization>::finalize_from_circuit_template(const CircuitTemplate& circuit_template)
+{
+    if (!matches_circuit_template(circuit_template)) {
+        info("circuit does not match its template, finalizing it in full");
+        return false;
+    }
+
+    size_t block_idx = 0;
+    for (auto& block : blocks.get()) {
+        const auto& gates = circuit_template.finalization_gates[block_idx++];
+        for (size_t wire_idx = 0; wire_idx < block.wires.size(); ++wire_idx) {
+            auto& wire = block.wires[wire_idx];
+            wire.insert(wire.end(), gates.wires[wire_idx].begin(), gates.wires[wire_idx].end());
+        }
+        for (size_t selector_idx = 0; selector_idx < block.selectors.size(); ++selector_idx) {
+            auto& selector = block.selectors[selector_idx];
+            selector.insert(selector.end(), gates.selectors[selector_idx].begin(), gates.selectors[selector_idx].end());
+        }
+    }
+
+    // The variables created by finalization that do not depend on the witness take their recorded values, the others
+    // are overwritten by the witness program
+    this->variables.insert(this->variables.end(),
+                           circuit_template.finalization_variables.begin(),
+                           circuit_template.finalization_variables.end());
+    this->next_var_index = circuit_template.next_var_index;
+    this->prev_var_index = circuit_template.prev_var_index;
+    this->real_variable_index = circuit_template.real_variable_index;
+    this->real_variable_tags = circuit_template.real_variable_tags;
+    this->tau = circuit_template.tau;
+    this->current_tag = circuit_template.current_tag;
+    this->num_gates = circuit_template.num_gates;
+    constant_variable_indices = circuit_template.constant_variable_indices;
+    range_lists = circuit_template.range_lists;
+    cached_partial_non_native_field_multiplications =
+        circuit_template.cached_partial_non_native_field_multiplications;
+
+    run_witness_program(circuit_template.witness_program);
+    circuit_template_state.finalized_from_template = true;
+    return true;
+}
+
+/**
+ * @brief Compute the values of the variables created by finalization that depend on the witness
+ * @details The ROM/RAM steps also append the memory records of the sorted records' gates, whose kind and pairing with
+ * the original records depend on the order of the records. The ROM/RAM steps are run before the range list steps,
+ * since RAM timestamp deltas are range constrained. Steps of the same kind write disjoint variables and run in
+ * parallel.
+ *
+ * @note ROM/RAM arrays are left unsorted, as they are not used once the circuit is finalized.
+ */
+template <typename Arithmetization>
+void UltraCircuitBuilder_<Arithmetization>::run_witness_program(
+    const std::vector<typename CircuitTemplate::WitnessOp>& witness_program)
+{
+    using WitnessOp = typename CircuitTemplate::WitnessOp;
+    std::vector<const WitnessOp*> memory_ops;
+    std::vector<const WitnessOp*> range_list_ops;
+    for (const auto& op : witness_program) {
+        (op.type == WitnessOp::Type::SORTED_RANGE_LIST ? range_list_ops : memory_ops).push_back(&op);
+    }
+
+    std::vector<std::vector<uint32_t>> read_records(memory_ops.size());
+    std::vector<std::vector<uint32_t>> write_records(memory_ops.size());
+    parallel_for(memory_ops.size(), [&](size_t op_idx) {
+        const WitnessOp& op = *memory_ops[op_idx];
+        uint32_t variable_idx = op.output_offset;
+        if (op.type == WitnessOp::Type::SORTED_ROM_RECORDS) {
+            std::vector<RomRecord> records = op.rom_records;
+            for (auto& record : records) {
+                record.index = static_cast<uint32_t>(uint256_t(this->get_variable(record.index_witness)));
+            }
+            std::sort(records.begin(), records.end());
+            for (size_t i = 0; i < records.size(); ++i) {
+                const RomRecord& record = records[i];
+                this->variables[variable_idx++] = FF((uint64_t)record.index);
+                this->variables[variable_idx++] = this->get_variable(record.value_column1_witness);
+                this->variables[variable_idx++] = this->get_variable(record.value_column2_witness);
+                variable_idx++; // the record witness, computed by the prover
+                read_records[op_idx].push_back(op.sorted_gate_indices[i]);
+                read_records[op_idx].push_back(static_cast<uint32_t>(record.gate_index));
+            }
+            return;
+        }
+        std::vector<RamRecord> records = op.ram_records;
+        for (auto& record : records) {
+            record.index = static_cast<uint32_t>(uint256_t(this->get_variable(record.index_witness)));
+        }
+        std::sort(records.begin(), records.end());
+        for (size_t i = 0; i < records.size(); ++i) {
+            const RamRecord& record = records[i];
+            this->variables[variable_idx++] = FF((uint64_t)record.index);
+            this->variables[variable_idx++] = record.timestamp;
+            this->variables[variable_idx++] = this->get_variable(record.value_witness);
+            variable_idx++; // the record witness, computed by the prover
+            auto& records_of_type =
+                record.access_type == RamRecord::AccessType::READ ? read_records[op_idx] : write_records[op_idx];
+            records_of_type.push_back(op.sorted_gate_indices[i]);
+            records_of_type.push_back(static_cast<uint32_t>(record.gate_index));
+        }
+        for (size_t i = 0; i + 1 < records.size(); ++i) {
+            const auto& current = records[i];
+            const auto& next = records[i + 1];
+            this->variables[op.timestamp_delta_offset + i] =
+                current.index == next.index ? FF(next.timestamp - current.timestamp) : FF(0);
+        }
+    });
+    for (size_t op_idx = 0; op_idx < memory_ops.size(); ++op_idx) {
+        memory_read_records.insert(memory_read_records.end(), read_records[op_idx].begin(), read_records[op_idx].end());
+        memory_write_records.insert(
+            memory_write_records.end(), write_records[op_idx].begin(), write_records[op_idx].end());
+    }
+
+    parallel_for(range_list_ops.size(), [&](size_t op_idx) {
+        const WitnessOp& op = *range_list_ops[op_idx];
+        std::vector<uint32_t> sorted_list;
+        sorted_list.reserve(op.variable_indices.size());
+        for (const auto variable_index : op.variable_indices) {
+            sorted_list.emplace_back((uint32_t)this->get_variable(variable_index).from_montgomery_form().data[0]);
+        }
+        std::sort(sorted_list.begin(), sorted_list.end());
+        for (size_t i = 0; i < sorted_list.size(); ++i) {
+            this->variables[op.output_offset + i] = sorted_list[i];
+        }
+    });
+}
+
 /**
  * @brief Poseidon2 external round gate, activates the q_poseidon2_external selector and relation
  */
@@ -11,6 +11,8 @@
 
 // TODO(md): note that this has now been added
 #include "circuit_builder_base.hpp"
+#include <map>
+#include <memory>
 #include <optional>
 #include <unordered_set>
 
@@ -276,6 +278,74 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
         uint32_t hi_3_idx;
     };
 
+    /**
+     * @brief The structure of a finalized circuit, recorded so that circuits built later with the same structure but a
+     * different witness can be finalized without redoing the work of finalization
+     *
+     * @details Finalization (see finalize_circuit) only appends gates, and the gates, copy constraints and tags it
+     * appends depend on the structure of the circuit alone. So do the values of most variables it creates. The
+     * exceptions are the sorted range lists, the sorted ROM/RAM records and the RAM timestamp deltas, whose indices are
+     * fixed but whose values depend on the witness. These are recomputed from the unfinalized circuit by the witness
+     * program, a short list of steps recorded alongside the structure.
+     *
+     * A circuit is finalized from a template only if it matches the unfinalized circuit the template was recorded from
+     * in its wires, copy constraints, public inputs, range lists, ROM/RAM records and queued non-native field
+     * multiplications. Otherwise it is finalized in full. Selector values are not compared; like the wires, they are
+     * assumed not to depend on the witness.
+     */
+    struct CircuitTemplate {
+        /**
+         * @brief A step of the witness program, computing the values of a run of variables created by finalization
+         */
+        struct WitnessOp {
+            enum class Type { SORTED_RANGE_LIST, SORTED_ROM_RECORDS, SORTED_RAM_RECORDS };
+            Type type = Type::SORTED_RANGE_LIST;
+            // The first of the contiguous variables written by the step
+            uint32_t output_offset = 0;
+            // SORTED_RANGE_LIST: the variables of the list, whose values are written in sorted order
+            std::vector<uint32_t> variable_indices;
+            // SORTED_ROM/RAM_RECORDS: the records of the array before sorting, and the gates of the sorted records.
+            // Four variables (index, two values or timestamp and value, record) are written per sorted record.
+            std::vector<RomRecord> rom_records;
+            std::vector<RamRecord> ram_records;
+            std::vector<uint32_t> sorted_gate_indices;
+            // SORTED_RAM_RECORDS: the first of the timestamp delta variables between consecutive sorted records
+            uint32_t timestamp_delta_offset = 0;
+        };
+
+        struct BlockGates {
+            std::vector<std::vector<uint32_t>> wires;
+            std::vector<std::vector<FF>> selectors;
+        };
+
+        // The unfinalized circuit
+        std::vector<std::vector<std::vector<uint32_t>>> unfinalized_block_wires;
+        std::vector<uint32_t> public_inputs;
+        std::vector<uint32_t> unfinalized_real_variable_index;
+        std::map<uint64_t, RangeList> unfinalized_range_lists;
+        std::vector<RomTranscript> unfinalized_rom_arrays;
+        std::vector<RamTranscript> unfinalized_ram_arrays;
+        std::vector<cached_partial_non_native_field_multiplication> unfinalized_non_native_field_multiplications;
+        size_t num_unfinalized_gates = 0;
+        size_t num_unfinalized_memory_read_records = 0;
+        size_t num_unfinalized_memory_write_records = 0;
+
+        // What finalization added to it
+        std::vector<BlockGates> finalization_gates;
+        std::vector<FF> finalization_variables;
+        std::vector<uint32_t> next_var_index;
+        std::vector<uint32_t> prev_var_index;
+        std::vector<uint32_t> real_variable_index;
+        std::vector<uint32_t> real_variable_tags;
+        std::map<uint32_t, uint32_t> tau;
+        uint32_t current_tag = DUMMY_TAG;
+        size_t num_gates = 0;
+        std::map<FF, uint32_t> constant_variable_indices;
+        std::map<uint64_t, RangeList> range_lists;
+        std::vector<cached_partial_non_native_field_multiplication> cached_partial_non_native_field_multiplications;
+        std::vector<WitnessOp> witness_program;
+    };
+
     // Storage for wires and selectors for all gate types
     GateBlocks blocks;
 
@@ -315,6 +385,21 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
 
     bool circuit_finalized = false;
 
+    // The templates recorded from and replayed into this circuit's finalization (see CircuitTemplate)
+    struct CircuitTemplateState {
+        bool record = false;
+        std::shared_ptr<const CircuitTemplate> replay;
+        std::shared_ptr<CircuitTemplate> recording;
+        std::shared_ptr<const CircuitTemplate> recorded;
+        bool finalized_from_template = false;
+        // Don't interfere with equality semantics of circuits
+        bool operator==(const CircuitTemplateState& other) const
+        {
+            static_cast<void>(other);
+            return true;
+        }
+    } circuit_template_state;
+
     void process_non_native_field_multiplications();
     UltraCircuitBuilder_(const size_t size_hint = 0)
         : CircuitBuilderBase<FF>(size_hint)
@@ -378,6 +463,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
         memory_write_records = other.memory_write_records;
         cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
         circuit_finalized = other.circuit_finalized;
+        circuit_template_state = other.circuit_template_state;
     };
     UltraCircuitBuilder_& operator=(const UltraCircuitBuilder_& other) = default;
     UltraCircuitBuilder_& operator=(UltraCircuitBuilder_&& other)
@@ -394,6 +480,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
         memory_write_records = other.memory_write_records;
         cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
         circuit_finalized = other.circuit_finalized;
+        circuit_template_state = other.circuit_template_state;
         return *this;
     };
     ~UltraCircuitBuilder_() override = default;
@@ -425,6 +512,25 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
 
     void add_gates_to_ensure_all_polys_are_non_zero();
 
+    /**
+     * Circuit Templates
+     **/
+    // Record a CircuitTemplate of the circuit when it is finalized in full
+    void record_circuit_template() { circuit_template_state.record = true; }
+    // Finalize the circuit from the given template if it matches it, and in full otherwise
+    void set_circuit_template(std::shared_ptr<const CircuitTemplate> circuit_template)
+    {
+        circuit_template_state.replay = std::move(circuit_template);
+    }
+    std::shared_ptr<const CircuitTemplate> get_circuit_template() const { return circuit_template_state.recorded; }
+    bool is_finalized_from_template() const { return circuit_template_state.finalized_from_template; }
+
+    void begin_circuit_template_recording();
+    void end_circuit_template_recording();
+    bool matches_circuit_template(const CircuitTemplate& circuit_template);
+    bool finalize_from_circuit_template(const CircuitTemplate& circuit_template);
+    void run_witness_program(const std::vector<typename CircuitTemplate::WitnessOp>& witness_program);
+
     void create_add_gate(const add_triple_<FF>& in) override;
     void create_big_mul_add_gate(const mul_quad_<FF>& in, const bool use_next_gate_w_4 = false);
     void create_big_add_gate(const add_quad_<FF>& in, const bool use_next_gate_w_4 = false);
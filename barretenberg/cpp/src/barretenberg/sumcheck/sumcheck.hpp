@@ -185,13 +185,18 @@ template <typename Flavor> class SumcheckProver {
      * @param relation_parameters
      * @param alpha Batching challenge for subrelations.
      * @param gate_challenges
+     * @param active_ranges Optional ranges of rows outside of which all relations vanish (e.g. the blocks of a
+     * structured trace); the edges outside of them are skipped in every round.
      * @return SumcheckOutput
      */
     SumcheckOutput<Flavor> prove(ProverPolynomials& full_polynomials,
                                  const bb::RelationParameters<FF>& relation_parameters,
                                  const RelationSeparator alpha,
-                                 const std::vector<FF>& gate_challenges)
+                                 const std::vector<FF>& gate_challenges,
+                                 const std::vector<std::pair<size_t, size_t>>& active_ranges = {})
     {
+        round.set_active_ranges(active_ranges);
+
         // In case the Flavor has ZK, we populate sumcheck data structure with randomness, compute correcting term for
         // the total sum, etc.
         if constexpr (Flavor::HasZK) {
@@ -218,6 +223,10 @@ template <typename Flavor> class SumcheckProver {
             multivariate_challenge.emplace_back(round_challenge);
             // Prepare sumcheck book-keeping table for the next round
             partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+            // The remaining rounds only read the book-keeping table, so the full polynomials are idle until the PCS
+            for (auto& polynomial : full_polynomials.get_all()) {
+                polynomial.evict();
+            }
             // Prepare ZK Sumcheck data for the next round
             if constexpr (Flavor::HasZK) {
                 update_zk_sumcheck_data(zk_sumcheck_data, round_challenge, round_idx);
@@ -226,6 +235,7 @@ template <typename Flavor> class SumcheckProver {
             round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
                                                       // release memory?        // All but final round
                                                       // We operate on partially_evaluated_polynomials in place.
+            round.collapse_active_ranges();
         }
         vinfo("completed sumcheck round 0");
         for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
@@ -252,6 +262,7 @@ template <typename Flavor> class SumcheckProver {
 
             gate_separators.partially_evaluate(round_challenge);
             round.round_size = round.round_size >> 1;
+            round.collapse_active_ranges();
             vinfo("completed sumcheck round ", round_idx);
         }
         // Check that the challenges \f$ u_0,\ldots, u_{d-1} \f$ do not satisfy the equation \f$ u_0(1-u_0) + \ldots +
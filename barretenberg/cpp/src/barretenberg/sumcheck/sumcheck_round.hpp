@@ -44,6 +44,12 @@ template <typename Flavor> class SumcheckProverRound {
      * @brief In Round \f$i = 0,\ldots, d-1\f$, equals \f$2^{d-i}\f$.
      */
     size_t round_size;
+    /**
+     * @brief Sorted, disjoint, edge-aligned ranges \f$[a, b)\f$ of the current round's rows outside of which all
+     * relations vanish identically. If non-empty, \ref compute_univariate "compute univariate" only visits the edges
+     * in these ranges. Ignored for ZK Flavors, since masking makes the inactive rows nonzero.
+     */
+    std::vector<std::pair<size_t, size_t>> active_edge_ranges;
     /**
      * @brief Number of batched sub-relations in \f$F\f$ specified by Flavor.
      *
@@ -73,6 +79,35 @@ template <typename Flavor> class SumcheckProverRound {
         Utils::zero_univariates(univariate_accumulators);
     }
 
+    /**
+     * @brief Set the rows of the first round that may contribute to the round univariates.
+     * @details Typically the blocks of a structured trace together with the lookup table and databus regions, see
+     * DeciderProvingKey_::compute_active_row_ranges. Each range is widened to whole edges and overlapping ranges are
+     * merged.
+     */
+    void set_active_ranges(const std::vector<std::pair<size_t, size_t>>& row_ranges)
+    {
+        active_edge_ranges.clear();
+        for (const auto& range : row_ranges) {
+            add_edge_range(range.first & ~static_cast<size_t>(1), range.second + (range.second & 1));
+        }
+    }
+
+    /**
+     * @brief Map the active ranges to the next round, in which row \f$ \ell \f$ is the partial evaluation of rows
+     * \f$ 2\ell \f$ and \f$ 2\ell + 1 \f$ of the previous one. Should be called right after halving #round_size.
+     */
+    void collapse_active_ranges()
+    {
+        auto previous_ranges = std::move(active_edge_ranges);
+        active_edge_ranges.clear();
+        for (const auto& range : previous_ranges) {
+            const size_t start = range.first >> 1;
+            const size_t end = range.second >> 1;
+            add_edge_range(start & ~static_cast<size_t>(1), end + (end & 1));
+        }
+    }
+
     /**
      * @brief  To compute the round univariate in Round \f$i\f$, the prover first computes the values of Honk
      polynomials \f$ P_1,\ldots, P_N \f$ at the points of the form \f$ (u_0,\ldots, u_{i-1}, k, \vec \ell)\f$ for \f$
@@ -165,13 +200,25 @@ template <typename Flavor> class SumcheckProverRound {
     {
         PROFILE_THIS_NAME("compute_univariate");
 
+        // Construct the work split over edges. Without active ranges, every edge is visited; with them, only the edges
+        // touching an active row are, and the split is balanced by the number of active edges.
+        std::vector<std::pair<size_t, size_t>> edge_ranges;
+        if constexpr (!Flavor::HasZK) {
+            edge_ranges = active_edge_ranges;
+        }
+        if (edge_ranges.empty()) {
+            edge_ranges.emplace_back(0, round_size);
+        }
+        size_t num_active_edges = 0;
+        for (const auto& range : edge_ranges) {
+            num_active_edges += (range.second - range.first) / 2;
+        }
+
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
-        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
         size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
-        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
+        size_t num_threads = bb::calculate_num_threads(2 * num_active_edges, min_iterations_per_thread);
 
         // Construct univariate accumulator containers; one per thread
         std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
@@ -185,10 +232,25 @@ template <typename Flavor> class SumcheckProverRound {
 
         // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
         parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
+            // This thread processes the active edges with (flattened) indices in [start, end)
+            size_t start = thread_idx * num_active_edges / num_threads;
+            size_t end = (thread_idx + 1) * num_active_edges / num_threads;
+
+            // Locate the range containing the first edge of this thread
+            size_t range_idx = 0;
+            size_t edges_before_range = 0;
+            while (edges_before_range + (edge_ranges[range_idx].second - edge_ranges[range_idx].first) / 2 <= start &&
+                   range_idx + 1 < edge_ranges.size()) {
+                edges_before_range += (edge_ranges[range_idx].second - edge_ranges[range_idx].first) / 2;
+                range_idx++;
+            }
+            size_t edge_idx = edge_ranges[range_idx].first + 2 * (start - edges_before_range);
 
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
+            for (size_t count = start; count < end; ++count) {
+                if (edge_idx >= edge_ranges[range_idx].second) {
+                    range_idx++;
+                    edge_idx = edge_ranges[range_idx].first;
+                }
                 if constexpr (!Flavor::HasZK) {
                     extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
                 } else {
@@ -203,6 +265,7 @@ template <typename Flavor> class SumcheckProverRound {
                                                 extended_edges[thread_idx],
                                                 relation_parameters,
                                                 gate_sparators[(edge_idx >> 1) * gate_sparators.periodicity]);
+                edge_idx += 2;
             }
         });
 
@@ -329,6 +392,23 @@ template <typename Flavor> class SumcheckProverRound {
     }
 
   private:
+    /**
+     * @brief Append an edge-aligned range to #active_edge_ranges, clamped to #round_size and merged with the previous
+     * range if they overlap. Ranges must be added in order of their start.
+     */
+    void add_edge_range(size_t start, size_t end)
+    {
+        end = std::min(end, round_size);
+        if (start >= end) {
+            return;
+        }
+        if (!active_edge_ranges.empty() && start <= active_edge_ranges.back().second) {
+            active_edge_ranges.back().second = std::max(active_edge_ranges.back().second, end);
+        } else {
+            active_edge_ranges.emplace_back(start, end);
+        }
+    }
+
     /**
      * @brief In Round \f$ i \f$, for a given point \f$ \vec \ell \in \{0,1\}^{d-1 - i}\f$, calculate the contribution
      * of each sub-relation to \f$ T^i(X_i) \f$.
@@ -0,0 +1,132 @@
+#include "batch_verifier.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+#include <algorithm>
+#include <optional>
+
+namespace bb {
+
+/**
+ * @brief Verify a batch of Ultra Honk proofs, each against its own verification key
+ *
+ * @return Whether all the proofs verified, and the indices of any that did not
+ */
+template <typename Flavor>
+typename UltraBatchVerifier_<Flavor>::Result UltraBatchVerifier_<Flavor>::verify_proofs(
+    const std::vector<std::shared_ptr<VerificationKey>>& verification_keys, const std::vector<HonkProof>& proofs)
+{
+    ASSERT(verification_keys.size() == proofs.size());
+    const size_t num_proofs = proofs.size();
+    Result result;
+    if (num_proofs == 0) {
+        result.verified = true;
+        return result;
+    }
+
+    // Draw the batching coefficients up front, the engine is not shared between threads
+    std::vector<FF> batching_coefficients(num_proofs);
+    for (auto& coefficient : batching_coefficients) {
+        coefficient = FF(numeric::get_randomness().get_random_uint128());
+    }
+
+    // Reduce each proof to its pairing points and weight them by the proof's coefficient
+    std::vector<std::optional<PairingPoints>> weighted_points(num_proofs);
+    parallel_for(num_proofs, [&](size_t idx) {
+        Verifier verifier{ verification_keys[idx] };
+        auto pairing_points = verifier.reduce_to_pairing_check(proofs[idx]);
+        if (pairing_points.has_value()) {
+            weighted_points[idx] = PairingPoints{ (*pairing_points)[0] * batching_coefficients[idx],
+                                                  (*pairing_points)[1] * batching_coefficients[idx] };
+        }
+    });
+
+    std::vector<PairingPoints> points_to_pair;
+    std::vector<size_t> indices_to_pair;
+    for (size_t idx = 0; idx < num_proofs; ++idx) {
+        if (weighted_points[idx].has_value()) {
+            indices_to_pair.emplace_back(idx);
+            points_to_pair.emplace_back(*weighted_points[idx]);
+        } else {
+            result.failed_proofs.emplace_back(idx);
+        }
+    }
+
+    if (!indices_to_pair.empty()) {
+        PairingPoints combined_points = points_to_pair[0];
+        for (size_t i = 1; i < points_to_pair.size(); ++i) {
+            combined_points[0] += points_to_pair[i][0];
+            combined_points[1] += points_to_pair[i][1];
+        }
+        // Positions into points_to_pair, mapped back to proof indices once the failed ones are found
+        std::vector<size_t> positions(indices_to_pair.size());
+        for (size_t i = 0; i < positions.size(); ++i) {
+            positions[i] = i;
+        }
+        std::vector<size_t> failed_positions;
+        find_failed_proofs(verification_keys[0], points_to_pair, positions, combined_points, failed_positions);
+        for (const size_t position : failed_positions) {
+            result.failed_proofs.emplace_back(indices_to_pair[position]);
+        }
+        std::sort(result.failed_proofs.begin(), result.failed_proofs.end());
+    }
+
+    result.verified = result.failed_proofs.empty();
+    return result;
+}
+
+/**
+ * @brief Verify a batch of Ultra Honk proofs of the same circuit
+ *
+ */
+template <typename Flavor>
+typename UltraBatchVerifier_<Flavor>::Result UltraBatchVerifier_<Flavor>::verify_proofs(
+    const std::shared_ptr<VerificationKey>& verification_key, const std::vector<HonkProof>& proofs)
+{
+    return verify_proofs(std::vector<std::shared_ptr<VerificationKey>>(proofs.size(), verification_key), proofs);
+}
+
+/**
+ * @brief Check the combined pairing of a set of proofs, bisecting it to find the failing proofs if it does not hold
+ *
+ * @param weighted_points The pairing points of each proof, multiplied by its batching coefficient
+ * @param indices The positions of the proofs in the set
+ * @param combined_points The sum of the weighted pairing points of the proofs in the set
+ * @param failed_proofs The positions of the proofs whose pairing check fails are appended to this
+ */
+template <typename Flavor>
+void UltraBatchVerifier_<Flavor>::find_failed_proofs(const std::shared_ptr<VerificationKey>& verification_key,
+                                                     const std::vector<PairingPoints>& weighted_points,
+                                                     const std::vector<size_t>& indices,
+                                                     const PairingPoints& combined_points,
+                                                     std::vector<size_t>& failed_proofs)
+{
+    if (verification_key->pcs_verification_key->pairing_check(combined_points[0], combined_points[1])) {
+        return;
+    }
+    if (indices.size() == 1) {
+        failed_proofs.emplace_back(indices[0]);
+        return;
+    }
+
+    const size_t half = indices.size() / 2;
+    const std::vector<size_t> left_indices(indices.begin(), indices.begin() + static_cast<std::ptrdiff_t>(half));
+    const std::vector<size_t> right_indices(indices.begin() + static_cast<std::ptrdiff_t>(half), indices.end());
+
+    // The right half's combined points are what remains of the whole once the left half is taken out
+    PairingPoints left_points = weighted_points[left_indices[0]];
+    for (size_t i = 1; i < left_indices.size(); ++i) {
+        left_points[0] += weighted_points[left_indices[i]][0];
+        left_points[1] += weighted_points[left_indices[i]][1];
+    }
+    const PairingPoints right_points{ combined_points[0] - left_points[0], combined_points[1] - left_points[1] };
+
+    find_failed_proofs(verification_key, weighted_points, left_indices, left_points, failed_proofs);
+    find_failed_proofs(verification_key, weighted_points, right_indices, right_points, failed_proofs);
+}
+
+template class UltraBatchVerifier_<UltraFlavor>;
+template class UltraBatchVerifier_<UltraKeccakFlavor>;
+template class UltraBatchVerifier_<MegaFlavor>;
+
+} // namespace bb
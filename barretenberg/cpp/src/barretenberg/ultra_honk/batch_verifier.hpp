@@ -0,0 +1,55 @@
+#pragma once
+#include "barretenberg/honk/proof_system/types/proof.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_keccak_flavor.hpp"
+#include "barretenberg/ultra_honk/ultra_verifier.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief Verifies many Ultra Honk proofs together, with a single pairing check between all of them
+ *
+ * @details Each proof is verified by an UltraVerifier_ up to its final pairing check e(P₀ⁱ, [1]₂)·e(P₁ⁱ, [x]₂) = 1, the
+ * proofs in parallel. The pairing checks of the proofs are then combined with random 128-bit coefficients ρᵢ into
+ *
+ *      e(∑ ρᵢ⋅P₀ⁱ, [1]₂)·e(∑ ρᵢ⋅P₁ⁱ, [x]₂) = 1,
+ *
+ * which holds with overwhelming probability only if all of them do, so a batch of valid proofs costs one pairing rather
+ * than one per proof. If the combined check fails, the batch is bisected, checking the combined pairing of each half
+ * until the proofs whose own check fails are found. Proofs whose Sumcheck fails are reported without being paired.
+ */
+template <typename Flavor> class UltraBatchVerifier_ {
+    using FF = typename Flavor::FF;
+    using VerificationKey = typename Flavor::VerificationKey;
+    using Verifier = UltraVerifier_<Flavor>;
+    using PairingPoints = typename Verifier::PairingPoints;
+
+  public:
+    struct Result {
+        bool verified = false;
+        std::vector<size_t> failed_proofs; // indices of the proofs that did not verify, in increasing order
+    };
+
+    static Result verify_proofs(const std::vector<std::shared_ptr<VerificationKey>>& verification_keys,
+                                const std::vector<HonkProof>& proofs);
+    static Result verify_proofs(const std::shared_ptr<VerificationKey>& verification_key,
+                                const std::vector<HonkProof>& proofs);
+
+  private:
+    static void find_failed_proofs(const std::shared_ptr<VerificationKey>& verification_key,
+                                   const std::vector<PairingPoints>& weighted_points,
+                                   const std::vector<size_t>& indices,
+                                   const PairingPoints& combined_points,
+                                   std::vector<size_t>& failed_proofs);
+};
+
+using UltraBatchVerifier = UltraBatchVerifier_<UltraFlavor>;
+using UltraKeccakBatchVerifier = UltraBatchVerifier_<UltraKeccakFlavor>;
+using MegaBatchVerifier = UltraBatchVerifier_<MegaFlavor>;
+
+} // namespace bb
@@ -0,0 +1,97 @@
+#include "barretenberg/ultra_honk/batch_verifier.hpp"
+#include "barretenberg/ecc/fields/field_conversion.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
+#include "barretenberg/ultra_honk/decider_proving_key.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+template <typename Flavor> class UltraBatchVerifierTests : public ::testing::Test {
+  public:
+    using BatchVerifier = UltraBatchVerifier_<Flavor>;
+    using DeciderProvingKey = DeciderProvingKey_<Flavor>;
+    using VerificationKey = typename Flavor::VerificationKey;
+    using Commitment = typename Flavor::Commitment;
+    using Prover = UltraProver_<Flavor>;
+    using Builder = typename Flavor::CircuitBuilder;
+
+    struct ProofAndKey {
+        HonkProof proof;
+        std::shared_ptr<VerificationKey> verification_key;
+    };
+
+    static ProofAndKey prove(size_t num_gates = 32)
+    {
+        Builder builder;
+        MockCircuits::add_arithmetic_gates_with_public_inputs(builder, 2);
+        MockCircuits::add_arithmetic_gates(builder, num_gates);
+        MockCircuits::add_lookup_gates(builder);
+
+        auto proving_key = std::make_shared<DeciderProvingKey>(builder);
+        auto verification_key = std::make_shared<VerificationKey>(proving_key->proving_key);
+        Prover prover(proving_key);
+        return { prover.construct_proof(), verification_key };
+    }
+
+    // Replace the KZG quotient commitment [W]₁, the last element of the proof, by another point, so that only the final
+    // pairing check of the proof fails
+    static void tamper_with_kzg_quotient(HonkProof& proof)
+    {
+        const auto frs = field_conversion::convert_to_bn254_frs(Commitment::one());
+        std::copy(frs.begin(), frs.end(), proof.end() - static_cast<std::ptrdiff_t>(frs.size()));
+    }
+
+  protected:
+    static void SetUpTestSuite() { bb::srs::init_crs_factory("../srs_db/ignition"); }
+};
+
+using FlavorTypes = testing::Types<UltraFlavor, UltraKeccakFlavor>;
+TYPED_TEST_SUITE(UltraBatchVerifierTests, FlavorTypes);
+
+/**
+ * @brief A batch of valid proofs, of different circuits, verifies with a single pairing
+ */
+TYPED_TEST(UltraBatchVerifierTests, ValidProofs)
+{
+    std::vector<HonkProof> proofs;
+    std::vector<std::shared_ptr<typename TestFixture::VerificationKey>> verification_keys;
+    for (size_t num_gates : { 16UL, 16UL, 200UL, 500UL, 16UL }) {
+        auto [proof, verification_key] = TestFixture::prove(num_gates);
+        proofs.emplace_back(proof);
+        verification_keys.emplace_back(verification_key);
+    }
+
+    auto result = TestFixture::BatchVerifier::verify_proofs(verification_keys, proofs);
+    EXPECT_TRUE(result.verified);
+    EXPECT_TRUE(result.failed_proofs.empty());
+
+    EXPECT_TRUE(TestFixture::BatchVerifier::verify_proofs(verification_keys[0], { proofs[0], proofs[1] }).verified);
+}
+
+/**
+ * @brief Proofs failing Sumcheck and proofs failing only their pairing check are both reported by index
+ */
+TYPED_TEST(UltraBatchVerifierTests, ReportsFailingProofs)
+{
+    constexpr size_t NUM_PROOFS = 7;
+    auto [proof, verification_key] = TestFixture::prove();
+    std::vector<HonkProof> proofs(NUM_PROOFS, proof);
+
+    // Change a public input, which fails Sumcheck
+    proofs[1][3] += 1;
+    // Change the KZG quotient commitments of two proofs, which fails the pairing check
+    TestFixture::tamper_with_kzg_quotient(proofs[4]);
+    TestFixture::tamper_with_kzg_quotient(proofs[6]);
+
+    auto result = TestFixture::BatchVerifier::verify_proofs(verification_key, proofs);
+    EXPECT_FALSE(result.verified);
+    EXPECT_EQ(result.failed_proofs, (std::vector<size_t>{ 1, 4, 6 }));
+
+    // The same proofs are rejected one at a time
+    for (size_t idx : result.failed_proofs) {
+        UltraVerifier_<TypeParam> verifier(verification_key);
+        EXPECT_FALSE(verifier.verify_proof(proofs[idx]));
+    }
+}
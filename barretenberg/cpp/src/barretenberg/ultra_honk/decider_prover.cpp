@@ -33,10 +33,12 @@ template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_relation_ch
 
         PROFILE_THIS_NAME("sumcheck.prove");
 
+        // Skip the inactive rows of a structured trace (no-op if active_row_ranges is empty)
         sumcheck_output = sumcheck.prove(proving_key->proving_key.polynomials,
                                          proving_key->relation_parameters,
                                          proving_key->alphas,
-                                         proving_key->gate_challenges);
+                                         proving_key->gate_challenges,
+                                         proving_key->proving_key.active_row_ranges);
     }
 }
 
@@ -55,6 +57,11 @@ template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_pcs_rounds(
     vinfo("made commitment key");
     using OpeningClaim = ProverOpeningClaim<Curve>;
 
+    // The polynomials were evicted after the first sumcheck round; read them back in ahead of the batching
+    for (auto& polynomial : proving_key->proving_key.polynomials.get_unshifted()) {
+        polynomial.prefetch();
+    }
+
     const OpeningClaim prover_opening_claim =
         ShpleminiProver_<Curve>::prove(proving_key->proving_key.circuit_size,
                                        proving_key->proving_key.polynomials.get_unshifted(),
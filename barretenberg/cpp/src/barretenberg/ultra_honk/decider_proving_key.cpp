@@ -80,6 +80,44 @@ void DeciderProvingKey_<Flavor>::construct_databus_polynomials(Circuit& circuit)
     }
 }
 
+/**
+ * @brief Compute the ranges of rows outside of which every relation vanishes identically
+ * @details In the padding between the blocks of a structured trace all wires, selectors and lookup/databus columns are
+ * zero, sigma = id and z_perm is constant, so each relation is zero at any affine combination of such rows. The active
+ * ranges are therefore the blocks themselves plus the regions holding data that is not tied to a block: the lookup
+ * tables (and their read counts/tags/inverses), the databus columns and the rows of the Lagrange polynomials.
+ *
+ * @tparam Flavor
+ * @param circuit
+ */
+template <IsHonkFlavor Flavor> void DeciderProvingKey_<Flavor>::compute_active_row_ranges(Circuit& circuit)
+{
+    std::vector<std::pair<size_t, size_t>> ranges;
+    for (auto& block : circuit.blocks.get()) {
+        const size_t start = block.trace_offset;
+        ranges.emplace_back(start, start + block.size());
+    }
+    // Lagrange first (and the zero row) and lagrange last
+    ranges.emplace_back(0, 1);
+    ranges.emplace_back(dyadic_circuit_size - 1, dyadic_circuit_size);
+    // Lookup tables and the log-derivative data defined over them
+    for (auto& table : proving_key.polynomials.get_tables()) {
+        ranges.emplace_back(table.start_index(), table.end_index());
+    }
+    ranges.emplace_back(proving_key.polynomials.lookup_read_counts.start_index(),
+                        proving_key.polynomials.lookup_read_counts.end_index());
+    ranges.emplace_back(proving_key.polynomials.lookup_inverses.start_index(),
+                        proving_key.polynomials.lookup_inverses.end_index());
+    if constexpr (HasDataBus<Flavor>) {
+        // Databus columns are not placed in a block; they start at row 0
+        ranges.emplace_back(0, proving_key.polynomials.calldata.end_index());
+        ranges.emplace_back(0, proving_key.polynomials.secondary_calldata.end_index());
+        ranges.emplace_back(0, proving_key.polynomials.return_data.end_index());
+    }
+
+    proving_key.active_row_ranges = merge_ranges(std::move(ranges));
+}
+
 template class DeciderProvingKey_<UltraFlavor>;
 template class DeciderProvingKey_<UltraKeccakFlavor>;
 template class DeciderProvingKey_<MegaFlavor>;
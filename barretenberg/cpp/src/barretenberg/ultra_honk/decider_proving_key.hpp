@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/execution_trace/execution_trace.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/plonk_honk_shared/arithmetization/mega_arithmetization.hpp"
@@ -9,6 +10,10 @@
 #include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_keccak_flavor.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
 
 namespace bb {
 /**
@@ -45,9 +50,46 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
     // The target sum, which is typically nonzero for a ProtogalaxyProver's accmumulator
     FF target_sum;
 
+    /**
+     * @brief The witness-independent (precomputed) polynomials of a proving key, together with the sizes and the
+     * structure hash of the circuit they were computed for
+     * @details Circuits built from the same program usually have the same precomputed polynomials whatever their
+     * witness, so keys for them can share these instead of recomputing them, see DeciderProvingKeyCache. They are only
+     * shared with a circuit whose structure hash (see compute_structure_hash) is the same, since a witness can change
+     * the layout of the gates without changing the sizes of the circuit. The polynomials are shared, not copied, so
+     * nothing may modify them once they are shared.
+     */
+    struct PrecomputedData {
+        size_t circuit_size = 0;
+        size_t num_gates = 0;
+        size_t num_public_inputs = 0;
+        uint64_t structure_hash = 0;
+        // In the order of get_precomputed()
+        std::vector<Polynomial> polynomials;
+
+        bool matches(Circuit& circuit, size_t dyadic_circuit_size) const
+        {
+            // A circuit that did not match the template it was given is not built like the circuits before it
+            if (circuit.circuit_template_state.replay != nullptr && !circuit.is_finalized_from_template()) {
+                return false;
+            }
+            return circuit_size == dyadic_circuit_size && num_gates == circuit.num_gates &&
+                   num_public_inputs == circuit.public_inputs.size() &&
+                   structure_hash == compute_structure_hash(circuit);
+        }
+    };
+
+    /**
+     * @brief Construct the proving key of a finalized circuit
+     *
+     * @param precomputed If given, and computed for a circuit of the same structure, the precomputed polynomials are
+     * shared from it rather than computed, leaving only the witness-dependent polynomials to construct. Not supported
+     * for Goblin flavors, which ignore it.
+     */
     DeciderProvingKey_(Circuit& circuit,
                        TraceStructure trace_structure = TraceStructure::NONE,
-                       std::shared_ptr<typename Flavor::CommitmentKey> commitment_key = nullptr)
+                       std::shared_ptr<typename Flavor::CommitmentKey> commitment_key = nullptr,
+                       std::shared_ptr<const PrecomputedData> precomputed = nullptr)
         : is_structured(trace_structure != TraceStructure::NONE)
     {
         PROFILE_THIS_NAME("DeciderProvingKey(Circuit&)");
@@ -55,6 +97,7 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
         vinfo("creating decider proving key");
 
         circuit.finalize_circuit(/* ensure_nonzero = */ true);
+        num_gates = circuit.num_gates;
 
         // If using a structured trace, set fixed block sizes, check their validity, and set the dyadic circuit size
         if (is_structured) {
@@ -64,6 +107,9 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
         } else {
             dyadic_circuit_size = compute_dyadic_size(circuit); // set dyadic size directly from circuit block sizes
         }
+        if constexpr (!IsGoblinFlavor<Flavor>) {
+            uses_precomputed_data = precomputed != nullptr && precomputed->matches(circuit, dyadic_circuit_size);
+        }
 
         // Complete the public inputs execution trace block from circuit.public_inputs
         Trace::populate_public_inputs_block(circuit);
@@ -94,7 +140,7 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
                         wire = Polynomial::shiftable(proving_key.circuit_size);
                     }
                 }
-                {
+                if (!uses_precomputed_data) {
                     PROFILE_THIS_NAME("allocating gate selectors");
                     vinfo("allocating gate selectors");
 
@@ -116,7 +162,7 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
                         }
                     }
                 }
-                {
+                if (!uses_precomputed_data) {
                     PROFILE_THIS_NAME("allocating non-gate selectors");
                     vinfo("allocating non-gate selectors");
 
@@ -164,7 +210,7 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
                 const size_t max_tables_size =
                     std::min(static_cast<size_t>(MAX_LOOKUP_TABLES_SIZE), dyadic_circuit_size - 1);
                 size_t table_offset = dyadic_circuit_size - max_tables_size;
-                {
+                if (!uses_precomputed_data) {
                     PROFILE_THIS_NAME("allocating table polynomials");
                     vinfo("allocating table polynomials");
 
@@ -177,7 +223,7 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
                         }
                     }
                 }
-                {
+                if (!uses_precomputed_data) {
                     PROFILE_THIS_NAME("allocating sigmas and ids");
                     vinfo("allocating sigmas and ids");
 
@@ -234,7 +280,7 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
                     proving_key.polynomials.z_perm = Polynomial::shiftable(proving_key.circuit_size);
                 }
 
-                {
+                if (!uses_precomputed_data) {
                     PROFILE_THIS_NAME("allocating lagrange polynomials");
                     vinfo("allocating lagrange polynomials");
 
@@ -243,13 +289,19 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
                     proving_key.polynomials.lagrange_last = Polynomial(1, dyadic_circuit_size, dyadic_circuit_size - 1);
                 }
             }
+            if (uses_precomputed_data) {
+                for (auto [polynomial, cached] :
+                     zip_view(proving_key.polynomials.get_precomputed(), precomputed->polynomials)) {
+                    polynomial = cached.share();
+                }
+            }
             // We can finally set the shifted polynomials now that all of the to_be_shifted polynomials are
             // defined.
             proving_key.polynomials.set_shifted(); // Ensure shifted wires are set correctly
         }
 
         // Construct and add to proving key the wire, selector and copy constraint polynomials
-        Trace::populate(circuit, proving_key, is_structured);
+        Trace::populate(circuit, proving_key, is_structured, /*populate_precomputed=*/!uses_precomputed_data);
 
         {
             PROFILE_THIS_NAME("constructing prover instance after trace populate");
@@ -264,10 +316,12 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
             }
         }
         // Set the lagrange polynomials
-        proving_key.polynomials.lagrange_first.at(0) = 1;
-        proving_key.polynomials.lagrange_last.at(dyadic_circuit_size - 1) = 1;
+        if (!uses_precomputed_data) {
+            proving_key.polynomials.lagrange_first.at(0) = 1;
+            proving_key.polynomials.lagrange_last.at(dyadic_circuit_size - 1) = 1;
+        }
 
-        {
+        if (!uses_precomputed_data) {
             PROFILE_THIS_NAME("constructing lookup table polynomials");
             vinfo("constructing lookup table polynomials");
 
@@ -285,6 +339,11 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
                                                  dyadic_circuit_size);
         }
 
+        // Record where the relations can be nonzero so that sumcheck can skip the padding of a structured trace
+        if (is_structured) {
+            compute_active_row_ranges(circuit);
+        }
+
         // Construct the public inputs array
         for (size_t i = 0; i < proving_key.num_public_inputs; ++i) {
             size_t idx = i + proving_key.pub_inputs_offset;
@@ -305,10 +364,106 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
 
     bool get_is_structured() { return is_structured; }
 
+    // Whether the precomputed polynomials were shared from the PrecomputedData given at construction
+    bool get_uses_precomputed_data() const { return uses_precomputed_data; }
+
+    /**
+     * @brief Share the precomputed polynomials of this key, for the keys of other circuits with the same structure
+     *
+     * @param circuit The circuit this key was constructed from
+     */
+    std::shared_ptr<PrecomputedData> share_precomputed_data(Circuit& circuit)
+    {
+        auto data = std::make_shared<PrecomputedData>();
+        data->circuit_size = dyadic_circuit_size;
+        data->num_gates = num_gates;
+        data->num_public_inputs = proving_key.num_public_inputs;
+        data->structure_hash = compute_structure_hash(circuit);
+        for (auto& polynomial : proving_key.polynomials.get_precomputed()) {
+            data->polynomials.emplace_back(polynomial.share());
+        }
+        return data;
+    }
+
+    /**
+     * @brief A hash of everything the precomputed polynomials are computed from, as it is in a finalized circuit: the
+     * selectors of the gates of each block, their wires as real variables (the copy constraints), the public inputs,
+     * the variable tags and the lookup tables
+     * @details The public inputs block is left out, so that the hash is the same before and after it is populated from
+     * the public inputs. The columns of the blocks are hashed in parallel.
+     */
+    static uint64_t compute_structure_hash(Circuit& circuit)
+    {
+        constexpr uint64_t PRIME = 0x9E3779B97F4A7C15ULL;
+        const auto mix = [](uint64_t hash, uint64_t word) { return (hash ^ word) * PRIME; };
+
+        auto blocks = circuit.blocks.get_gate_blocks();
+        using Block = std::remove_cvref_t<decltype(blocks[0])>;
+        constexpr size_t NUM_COLUMNS = NUM_WIRES + std::tuple_size_v<typename Block::Selectors>;
+        std::vector<uint64_t> column_hashes(blocks.size() * NUM_COLUMNS);
+        parallel_for(column_hashes.size(), [&](size_t idx) {
+            auto& block = blocks[idx / NUM_COLUMNS];
+            const size_t column = idx % NUM_COLUMNS;
+            uint64_t hash = mix(column, block.size());
+            if (column < NUM_WIRES) {
+                for (const uint32_t variable : block.wires[column]) {
+                    hash = mix(hash, circuit.real_variable_index[variable]);
+                }
+            } else {
+                for (const FF& value : block.selectors[column - NUM_WIRES]) {
+                    for (const uint64_t limb : value.data) {
+                        hash = mix(hash, limb);
+                    }
+                }
+            }
+            column_hashes[idx] = hash;
+        });
+
+        uint64_t hash = 0;
+        for (const uint64_t column_hash : column_hashes) {
+            hash = mix(hash, column_hash);
+        }
+        for (const uint32_t public_input : circuit.public_inputs) {
+            hash = mix(hash, circuit.real_variable_index[public_input]);
+        }
+        for (const uint32_t tag : circuit.real_variable_tags) {
+            hash = mix(hash, tag);
+        }
+        for (const auto& [tag, next_tag] : circuit.tau) {
+            hash = mix(mix(hash, tag), next_tag);
+        }
+        for (const auto& table : circuit.lookup_tables) {
+            hash = mix(mix(mix(hash, static_cast<uint64_t>(table.id)), table.table_index), table.size());
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Sort a list of ranges [start, end) and merge those that overlap or touch; empty ranges are dropped
+     */
+    static std::vector<std::pair<size_t, size_t>> merge_ranges(std::vector<std::pair<size_t, size_t>> ranges)
+    {
+        std::sort(ranges.begin(), ranges.end());
+        std::vector<std::pair<size_t, size_t>> merged;
+        for (const auto& range : ranges) {
+            if (range.first >= range.second) {
+                continue;
+            }
+            if (!merged.empty() && range.first <= merged.back().second) {
+                merged.back().second = std::max(merged.back().second, range.second);
+            } else {
+                merged.emplace_back(range);
+            }
+        }
+        return merged;
+    }
+
   private:
     static constexpr size_t num_zero_rows = Flavor::has_zero_row ? 1 : 0;
     static constexpr size_t NUM_WIRES = Circuit::NUM_WIRES;
     size_t dyadic_circuit_size = 0; // final power-of-2 circuit size
+    size_t num_gates = 0;           // number of gates of the finalized circuit
+    bool uses_precomputed_data = false;
 
     size_t compute_dyadic_size(Circuit&);
 
@@ -324,6 +479,8 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
 
     void construct_databus_polynomials(Circuit&)
         requires IsGoblinFlavor<Flavor>;
+
+    void compute_active_row_ranges(Circuit&);
 };
 
 } // namespace bb
@@ -0,0 +1,169 @@
+#include "decider_proving_key_cache.hpp"
+#include "barretenberg/common/log.hpp"
+
+#include <algorithm>
+
+namespace bb {
+
+template <IsUltraFlavor Flavor>
+    requires(!IsGoblinFlavor<Flavor>)
+DeciderProvingKeyCache<Flavor>& DeciderProvingKeyCache<Flavor>::get()
+{
+    static DeciderProvingKeyCache cache;
+    return cache;
+}
+
+template <IsUltraFlavor Flavor>
+    requires(!IsGoblinFlavor<Flavor>)
+typename std::list<typename DeciderProvingKeyCache<Flavor>::Entry>::iterator DeciderProvingKeyCache<Flavor>::find(
+    const ProgramHash& program_hash, TraceStructure trace_structure)
+{
+    auto it = std::find_if(entries.begin(), entries.end(), [&](const Entry& entry) {
+        return entry.program_hash == program_hash && entry.trace_structure == trace_structure;
+    });
+    if (it != entries.end()) {
+        entries.splice(entries.begin(), entries, it);
+        return entries.begin();
+    }
+    return entries.end();
+}
+
+template <IsUltraFlavor Flavor>
+    requires(!IsGoblinFlavor<Flavor>)
+void DeciderProvingKeyCache<Flavor>::evict_to_capacity()
+{
+    while (entries.size() > capacity) {
+        entries.pop_back();
+    }
+}
+
+template <IsUltraFlavor Flavor>
+    requires(!IsGoblinFlavor<Flavor>)
+std::shared_ptr<typename DeciderProvingKeyCache<Flavor>::DeciderProvingKey> DeciderProvingKeyCache<
+    Flavor>::construct_proving_key(const ProgramHash& program_hash, Circuit& circuit, TraceStructure trace_structure)
+{
+    std::shared_ptr<const PrecomputedData> precomputed;
+    std::shared_ptr<const CircuitTemplate> circuit_template;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = find(program_hash, trace_structure);
+        if (it != entries.end()) {
+            precomputed = it->precomputed;
+            circuit_template = it->circuit_template;
+        }
+    }
+
+    // The circuit is finalized from the template of the program if it matches it, and a new template is recorded
+    // otherwise
+    if (!circuit.circuit_finalized) {
+        circuit.set_circuit_template(circuit_template);
+        circuit.record_circuit_template();
+    }
+
+    // Constructed outside of the lock, so that keys for different programs can be constructed concurrently
+    auto proving_key = std::make_shared<DeciderProvingKey>(circuit, trace_structure, nullptr, precomputed);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto recorded_template = circuit.get_circuit_template();
+    if (recorded_template != nullptr) {
+        if (auto it = find(program_hash, trace_structure); it != entries.end()) {
+            it->circuit_template = recorded_template;
+        }
+    }
+    if (proving_key->get_uses_precomputed_data()) {
+        num_hits++;
+        vinfo("proving key cache hit");
+        return proving_key;
+    }
+    num_misses++;
+    vinfo("proving key cache miss");
+    if (capacity == 0) {
+        return proving_key;
+    }
+    // Either there was no entry, or the circuit did not match it; in both cases this key's data replaces it
+    auto it = find(program_hash, trace_structure);
+    if (it == entries.end()) {
+        entries.push_front({ program_hash, trace_structure, nullptr, nullptr, nullptr });
+        it = entries.begin();
+    }
+    it->precomputed = proving_key->share_precomputed_data(circuit);
+    it->verification_key = nullptr;
+    if (recorded_template != nullptr) {
+        it->circuit_template = recorded_template;
+    }
+    evict_to_capacity();
+    return proving_key;
+}
+
+template <IsUltraFlavor Flavor>
+    requires(!IsGoblinFlavor<Flavor>)
+std::shared_ptr<typename DeciderProvingKeyCache<Flavor>::VerificationKey> DeciderProvingKeyCache<
+    Flavor>::get_verification_key(const ProgramHash& program_hash,
+                                  DeciderProvingKey& proving_key,
+                                  TraceStructure trace_structure)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = find(program_hash, trace_structure);
+        if (it != entries.end() && it->verification_key != nullptr) {
+            return it->verification_key;
+        }
+    }
+
+    auto verification_key = std::make_shared<VerificationKey>(proving_key.proving_key);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = find(program_hash, trace_structure);
+    if (it != entries.end()) {
+        it->verification_key = verification_key;
+    }
+    return verification_key;
+}
+
+template <IsUltraFlavor Flavor>
+    requires(!IsGoblinFlavor<Flavor>)
+void DeciderProvingKeyCache<Flavor>::set_capacity(size_t new_capacity)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    capacity = new_capacity;
+    evict_to_capacity();
+}
+
+template <IsUltraFlavor Flavor>
+    requires(!IsGoblinFlavor<Flavor>)
+void DeciderProvingKeyCache<Flavor>::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    num_hits = 0;
+    num_misses = 0;
+}
+
+template <IsUltraFlavor Flavor>
+    requires(!IsGoblinFlavor<Flavor>)
+size_t DeciderProvingKeyCache<Flavor>::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+template <IsUltraFlavor Flavor>
+    requires(!IsGoblinFlavor<Flavor>)
+size_t DeciderProvingKeyCache<Flavor>::get_num_hits() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return num_hits;
+}
+
+template <IsUltraFlavor Flavor>
+    requires(!IsGoblinFlavor<Flavor>)
+size_t DeciderProvingKeyCache<Flavor>::get_num_misses() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return num_misses;
+}
+
+template class DeciderProvingKeyCache<UltraFlavor>;
+template class DeciderProvingKeyCache<UltraKeccakFlavor>;
+
+} // namespace bb
@@ -0,0 +1,99 @@
+#pragma once
+#include "barretenberg/ultra_honk/decider_proving_key.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+
+namespace bb {
+
+/**
+ * @brief A cache of the witness-independent parts of the proving keys of recently proven programs
+ *
+ * @details Proving the same program again with a different witness gives a circuit with the same structure, and so the
+ * same selector, sigma/id, lookup table and Lagrange polynomials and the same verification key. The cache keeps these
+ * for the last few programs proven, so that constructing the proving key of a program that is proven repeatedly (e.g.
+ * by a long-running prover process) only constructs the wire and other witness-dependent polynomials.
+ *
+ * Entries are keyed by a hash of the program, e.g. the SHA-256 of its bytecode, and by the trace structure. There is
+ * one cache per flavor. The program alone does not fix the structure of its circuits, e.g. a branch on the witness can
+ * move gates around, so a cached entry is only used if the new circuit has the sizes and the structure hash (see
+ * DeciderProvingKey_::compute_structure_hash) of the circuit it was computed from, and is replaced otherwise.
+ *
+ * The cached polynomials are allocated like any other polynomial, so if file-backed memory is enabled (see
+ * file_backed_memory.hpp) the large ones live in memory-mapped files which the kernel can page out between proofs.
+ *
+ * Each entry also keeps the CircuitTemplate of the program's circuit, so that later circuits of the program are finalized
+ * from it rather than in full (see UltraCircuitBuilder_::CircuitTemplate).
+ *
+ * Entries stay alive for the lifetime of the process, so the cache is only meant for long-running provers such as the
+ * bb server. One-shot entry points (e.g. the WASM bindings) construct their proving keys directly.
+ *
+ * Not available for Goblin flavors, whose proving keys write to some precomputed polynomials alongside witness data.
+ */
+template <IsUltraFlavor Flavor>
+    requires(!IsGoblinFlavor<Flavor>)
+class DeciderProvingKeyCache {
+  public:
+    using DeciderProvingKey = DeciderProvingKey_<Flavor>;
+    using PrecomputedData = typename DeciderProvingKey::PrecomputedData;
+    using VerificationKey = typename Flavor::VerificationKey;
+    using Circuit = typename Flavor::CircuitBuilder;
+    using CircuitTemplate = typename Circuit::CircuitTemplate;
+    using ProgramHash = std::array<uint8_t, 32>;
+
+    static constexpr size_t DEFAULT_CAPACITY = 4;
+
+    static DeciderProvingKeyCache& get();
+
+    /**
+     * @brief Construct the proving key of a circuit built from the given program, sharing its precomputed polynomials
+     * with the cached ones if there are any, and caching them otherwise
+     */
+    std::shared_ptr<DeciderProvingKey> construct_proving_key(const ProgramHash& program_hash,
+                                                             Circuit& circuit,
+                                                             TraceStructure trace_structure = TraceStructure::NONE);
+
+    /**
+     * @brief The verification key of a proving key constructed by construct_proving_key for the given program,
+     * computed once per cached entry
+     */
+    std::shared_ptr<VerificationKey> get_verification_key(const ProgramHash& program_hash,
+                                                          DeciderProvingKey& proving_key,
+                                                          TraceStructure trace_structure = TraceStructure::NONE);
+
+    // Set the maximum number of programs to keep, evicting the least recently used ones beyond it
+    void set_capacity(size_t new_capacity);
+    void clear();
+
+    size_t size() const;
+    size_t get_num_hits() const;
+    size_t get_num_misses() const;
+
+  private:
+    struct Entry {
+        ProgramHash program_hash;
+        TraceStructure trace_structure;
+        std::shared_ptr<const PrecomputedData> precomputed;
+        std::shared_ptr<VerificationKey> verification_key;
+        std::shared_ptr<const CircuitTemplate> circuit_template;
+    };
+
+    DeciderProvingKeyCache() = default;
+
+    // Moves the entry to the front of the list and returns it, or returns end() if there is none
+    typename std::list<Entry>::iterator find(const ProgramHash& program_hash, TraceStructure trace_structure);
+    void evict_to_capacity();
+
+    // Most recently used first
+    std::list<Entry> entries;
+    size_t capacity = DEFAULT_CAPACITY;
+    size_t num_hits = 0;
+    size_t num_misses = 0;
+    mutable std::mutex mutex;
+};
+
+} // namespace bb
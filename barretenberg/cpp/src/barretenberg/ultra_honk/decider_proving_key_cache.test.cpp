@@ -0,0 +1,167 @@
+#include "barretenberg/ultra_honk/decider_proving_key_cache.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
+#include "barretenberg/ultra_honk/ultra_verifier.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+template <typename Flavor> class DeciderProvingKeyCacheTests : public ::testing::Test {
+  public:
+    using Cache = DeciderProvingKeyCache<Flavor>;
+    using DeciderProvingKey = DeciderProvingKey_<Flavor>;
+    using Prover = UltraProver_<Flavor>;
+    using Verifier = UltraVerifier_<Flavor>;
+    using Builder = typename Flavor::CircuitBuilder;
+    using ProgramHash = typename Cache::ProgramHash;
+
+    static constexpr ProgramHash PROGRAM_A{ 1 };
+    static constexpr ProgramHash PROGRAM_B{ 2 };
+
+    // Circuits of the same program have the same structure, but a random witness each time
+    static Builder build_circuit(size_t num_gates = 32)
+    {
+        Builder builder;
+        MockCircuits::add_arithmetic_gates_with_public_inputs(builder, 2);
+        MockCircuits::add_arithmetic_gates(builder, num_gates);
+        MockCircuits::add_lookup_gates(builder);
+        return builder;
+    }
+
+  protected:
+    static void SetUpTestSuite() { bb::srs::init_crs_factory("../srs_db/ignition"); }
+
+    void SetUp() override
+    {
+        Cache::get().clear();
+        Cache::get().set_capacity(Cache::DEFAULT_CAPACITY);
+    }
+    void TearDown() override { Cache::get().clear(); }
+};
+
+using FlavorTypes = testing::Types<UltraFlavor, UltraKeccakFlavor>;
+TYPED_TEST_SUITE(DeciderProvingKeyCacheTests, FlavorTypes);
+
+/**
+ * @brief Proving a program again shares the cached precomputed polynomials, which equal those constructed from scratch,
+ * and gives a valid proof
+ */
+TYPED_TEST(DeciderProvingKeyCacheTests, CacheHitMatchesFreshProvingKey)
+{
+    using Cache = typename TestFixture::Cache;
+    auto& cache = Cache::get();
+
+    auto first_circuit = TestFixture::build_circuit();
+    auto first_key = cache.construct_proving_key(TestFixture::PROGRAM_A, first_circuit);
+    EXPECT_FALSE(first_key->get_uses_precomputed_data());
+    EXPECT_EQ(cache.get_num_misses(), 1);
+
+    auto circuit = TestFixture::build_circuit();
+    auto fresh_circuit = circuit;
+    auto proving_key = cache.construct_proving_key(TestFixture::PROGRAM_A, circuit);
+    EXPECT_TRUE(proving_key->get_uses_precomputed_data());
+    EXPECT_TRUE(circuit.is_finalized_from_template());
+    EXPECT_EQ(cache.get_num_hits(), 1);
+    EXPECT_EQ(cache.size(), 1);
+
+    auto fresh_key = std::make_shared<typename TestFixture::DeciderProvingKey>(fresh_circuit);
+    for (auto [cached, fresh] : zip_view(proving_key->proving_key.polynomials.get_precomputed(),
+                                         fresh_key->proving_key.polynomials.get_precomputed())) {
+        EXPECT_TRUE(cached == fresh);
+    }
+    for (auto [cached, fresh] : zip_view(proving_key->proving_key.polynomials.get_witness(),
+                                         fresh_key->proving_key.polynomials.get_witness())) {
+        EXPECT_TRUE(cached == fresh);
+    }
+
+    auto verification_key = cache.get_verification_key(TestFixture::PROGRAM_A, *proving_key);
+    EXPECT_EQ(verification_key, cache.get_verification_key(TestFixture::PROGRAM_A, *first_key));
+    typename TestFixture::Prover prover(proving_key);
+    typename TestFixture::Verifier verifier(verification_key);
+    auto proof = prover.construct_proof();
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
+/**
+ * @brief A circuit whose sizes do not match the entry of its program replaces it rather than using it
+ */
+TYPED_TEST(DeciderProvingKeyCacheTests, MismatchedCircuitReplacesEntry)
+{
+    using Cache = typename TestFixture::Cache;
+    auto& cache = Cache::get();
+
+    auto circuit = TestFixture::build_circuit();
+    cache.construct_proving_key(TestFixture::PROGRAM_A, circuit);
+
+    auto larger_circuit = TestFixture::build_circuit(/*num_gates=*/64);
+    auto proving_key = cache.construct_proving_key(TestFixture::PROGRAM_A, larger_circuit);
+    EXPECT_FALSE(proving_key->get_uses_precomputed_data());
+    EXPECT_EQ(cache.get_num_misses(), 2);
+    EXPECT_EQ(cache.size(), 1);
+
+    auto next_circuit = TestFixture::build_circuit(/*num_gates=*/64);
+    EXPECT_TRUE(cache.construct_proving_key(TestFixture::PROGRAM_A, next_circuit)->get_uses_precomputed_data());
+}
+
+/**
+ * @brief A circuit with the sizes of the entry of its program but other gates does not use the entry
+ */
+TYPED_TEST(DeciderProvingKeyCacheTests, CircuitWithOtherGatesMisses)
+{
+    using Cache = typename TestFixture::Cache;
+    using FF = typename TypeParam::FF;
+    auto& cache = Cache::get();
+
+    // The last gate of each circuit is a + b + c - d = 0 with other selectors or wires than those before it
+    const auto build_circuit = [](bool scale_selectors, bool repeat_wire) {
+        auto builder = TestFixture::build_circuit(/*num_gates=*/31);
+        const FF a = FF::random_element();
+        const FF b = repeat_wire ? a : FF::random_element();
+        const FF c = FF::random_element();
+        const FF scale = scale_selectors ? FF(2) : FF(1);
+        const uint32_t a_idx = builder.add_variable(a);
+        const uint32_t b_idx = repeat_wire ? a_idx : builder.add_variable(b);
+        const uint32_t c_idx = builder.add_variable(c);
+        const uint32_t d_idx = builder.add_variable(a + b + c);
+        builder.create_big_add_gate({ a_idx, b_idx, c_idx, d_idx, scale, scale, scale, -scale, FF(0) });
+        return builder;
+    };
+
+    auto circuit = build_circuit(false, false);
+    cache.construct_proving_key(TestFixture::PROGRAM_A, circuit);
+
+    for (auto [scale_selectors, repeat_wire] : { std::pair{ true, false }, std::pair{ false, true } }) {
+        auto other_circuit = build_circuit(scale_selectors, repeat_wire);
+        auto proving_key = cache.construct_proving_key(TestFixture::PROGRAM_A, other_circuit);
+        EXPECT_FALSE(proving_key->get_uses_precomputed_data());
+
+        auto verification_key = cache.get_verification_key(TestFixture::PROGRAM_A, *proving_key);
+        typename TestFixture::Prover prover(proving_key);
+        typename TestFixture::Verifier verifier(verification_key);
+        EXPECT_TRUE(verifier.verify_proof(prover.construct_proof()));
+    }
+    EXPECT_EQ(cache.get_num_hits(), 0);
+    EXPECT_EQ(cache.get_num_misses(), 3);
+}
+
+/**
+ * @brief Beyond its capacity, the cache evicts the least recently used program
+ */
+TYPED_TEST(DeciderProvingKeyCacheTests, EvictsLeastRecentlyUsedProgram)
+{
+    using Cache = typename TestFixture::Cache;
+    auto& cache = Cache::get();
+    cache.set_capacity(1);
+
+    auto circuit_a = TestFixture::build_circuit();
+    cache.construct_proving_key(TestFixture::PROGRAM_A, circuit_a);
+    auto circuit_b = TestFixture::build_circuit();
+    cache.construct_proving_key(TestFixture::PROGRAM_B, circuit_b);
+    EXPECT_EQ(cache.size(), 1);
+
+    auto next_circuit_a = TestFixture::build_circuit();
+    EXPECT_FALSE(cache.construct_proving_key(TestFixture::PROGRAM_A, next_circuit_a)->get_uses_precomputed_data());
+    EXPECT_EQ(cache.get_num_misses(), 3);
+}
@@ -36,6 +36,22 @@ template <typename Flavor> bool DeciderVerifier_<Flavor>::verify_proof(const Dec
  *
  */
 template <typename Flavor> bool DeciderVerifier_<Flavor>::verify()
+{
+    const auto pairing_points = reduce_to_pairing_check();
+    if (!pairing_points.has_value()) {
+        return false;
+    }
+    return pcs_verification_key->pairing_check((*pairing_points)[0], (*pairing_points)[1]);
+}
+
+/**
+ * @brief Run Sumcheck and reduce the opening claims of the decider proof to the points of its final pairing check
+ * @details The pairing check itself is left to the caller, so that the checks of many proofs can be batched into one.
+ *
+ * @return The pairing points (P₀, P₁), or std::nullopt if Sumcheck did not verify
+ */
+template <typename Flavor>
+std::optional<typename DeciderVerifier_<Flavor>::PairingPoints> DeciderVerifier_<Flavor>::reduce_to_pairing_check()
 {
     using PCS = typename Flavor::PCS;
     using Curve = typename Flavor::Curve;
@@ -50,10 +66,10 @@ template <typename Flavor> bool DeciderVerifier_<Flavor>::verify()
     auto [multivariate_challenge, claimed_evaluations, sumcheck_verified] =
         sumcheck.verify(accumulator->relation_parameters, accumulator->alphas, accumulator->gate_challenges);
 
-    // If Sumcheck did not verify, return false
-    if (sumcheck_verified.has_value() && !sumcheck_verified.value()) {
+    // If Sumcheck did not verify, there is nothing to check the pairing of
+    if (!sumcheck_verified.has_value() || !sumcheck_verified.value()) {
         info("Sumcheck verification failed.");
-        return false;
+        return std::nullopt;
     }
 
     const auto opening_claim = Shplemini::compute_batch_opening_claim(accumulator->verification_key->circuit_size,
@@ -65,9 +81,7 @@ template <typename Flavor> bool DeciderVerifier_<Flavor>::verify()
                                                                       Commitment::one(),
                                                                       transcript);
     const auto pairing_points = PCS::reduce_verify_batch_opening_claim(opening_claim, transcript);
-    bool verified = pcs_verification_key->pairing_check(pairing_points[0], pairing_points[1]);
-
-    return sumcheck_verified.value() && verified;
+    return PairingPoints{ pairing_points[0], pairing_points[1] };
 }
 
 template class DeciderVerifier_<UltraFlavor>;
@@ -16,6 +16,9 @@ template <typename Flavor> class DeciderVerifier_ {
     using DeciderProof = std::vector<FF>;
 
   public:
+    // The points (P₀, P₁) of the final pairing check e(P₀, [1]₂)·e(P₁, [x]₂) = 1
+    using PairingPoints = std::array<typename Flavor::Curve::Element, 2>;
+
     explicit DeciderVerifier_();
     /**
      * @brief Constructor from a verification key and a transcript assumed to be initialized with a full Honk proof
@@ -30,6 +33,7 @@ template <typename Flavor> class DeciderVerifier_ {
 
     bool verify_proof(const DeciderProof&); // used when a decider proof is known explicitly
     bool verify();                          // used when transcript that has been initialized with a proof
+    std::optional<PairingPoints> reduce_to_pairing_check();
     std::shared_ptr<VerificationKey> key;
     std::map<std::string, Commitment> commitments;
     std::shared_ptr<DeciderVerificationKey> accumulator;
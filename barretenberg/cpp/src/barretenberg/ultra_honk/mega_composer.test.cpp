@@ -6,8 +6,10 @@
 #include "barretenberg/goblin/mock_circuits.hpp"
 #include "barretenberg/stdlib_circuit_builders/mega_circuit_builder.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/sumcheck/sumcheck.hpp"
 #include "barretenberg/ultra_honk/merge_prover.hpp"
 #include "barretenberg/ultra_honk/merge_verifier.hpp"
+#include "barretenberg/ultra_honk/oink_prover.hpp"
 #include "barretenberg/ultra_honk/ultra_prover.hpp"
 #include "barretenberg/ultra_honk/ultra_verifier.hpp"
 
@@ -95,6 +97,57 @@ TEST_F(MegaHonkTests, BasicStructured)
     EXPECT_TRUE(verifier.verify_proof(proof));
 }
 
+/**
+ * @brief Check that a sumcheck restricted to the active rows of a structured trace produces exactly the same transcript
+ * as one over the full hypercube
+ *
+ */
+TEST_F(MegaHonkTests, StructuredTraceSumcheckRowSkipping)
+{
+    using Flavor = MegaFlavor;
+    using Transcript = Flavor::Transcript;
+    using Sumcheck = SumcheckProver<Flavor>;
+
+    MegaCircuitBuilder builder;
+    GoblinMockCircuits::construct_simple_circuit(builder);
+
+    auto proving_key = std::make_shared<DeciderProvingKey_<Flavor>>(builder, TraceStructure::SMALL_TEST);
+    const auto& active_ranges = proving_key->proving_key.active_row_ranges;
+    const size_t circuit_size = proving_key->proving_key.circuit_size;
+
+    // The structured trace should contain inactive rows for the test to be meaningful
+    size_t num_active_rows = 0;
+    for (const auto& range : active_ranges) {
+        num_active_rows += range.second - range.first;
+    }
+    EXPECT_GT(num_active_rows, 0UL);
+    EXPECT_LT(num_active_rows, circuit_size);
+
+    // Populate the witness polynomials and relation parameters
+    OinkProver<Flavor> oink_prover(proving_key, std::make_shared<Transcript>());
+    oink_prover.prove();
+    std::vector<FF> gate_challenges(CONST_PROOF_SIZE_LOG_N);
+    for (auto& challenge : gate_challenges) {
+        challenge = FF::random_element(&engine);
+    }
+
+    auto full_transcript = std::make_shared<Transcript>();
+    Sumcheck full_sumcheck(circuit_size, full_transcript);
+    auto full_output = full_sumcheck.prove(
+        proving_key->proving_key.polynomials, proving_key->relation_parameters, proving_key->alphas, gate_challenges);
+
+    auto skipping_transcript = std::make_shared<Transcript>();
+    Sumcheck skipping_sumcheck(circuit_size, skipping_transcript);
+    auto skipping_output = skipping_sumcheck.prove(proving_key->proving_key.polynomials,
+                                                   proving_key->relation_parameters,
+                                                   proving_key->alphas,
+                                                   gate_challenges,
+                                                   active_ranges);
+
+    EXPECT_EQ(full_output.challenge, skipping_output.challenge);
+    EXPECT_EQ(full_transcript->proof_data, skipping_transcript->proof_data);
+}
+
 /**
  * @brief Test proof construction/verification for a circuit with ECC op gates, public inputs, and basic arithmetic
  * gates
@@ -199,6 +199,10 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_log_derivative_
     proving_key->relation_parameters.beta = beta;
     proving_key->relation_parameters.gamma = gamma;
 
+    // The inverses are computed from the lookup tables, which have not been read since the trace was populated
+    for (auto& polynomial : proving_key->proving_key.polynomials.get_tables()) {
+        polynomial.prefetch();
+    }
     // Compute the inverses used in log-derivative lookup relations
     proving_key->proving_key.compute_logderivative_inverses(proving_key->relation_parameters);
 
@@ -232,6 +236,13 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_log_derivative_
 template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_grand_product_computation_round()
 {
     PROFILE_THIS_NAME("OinkProver::execute_grand_product_computation_round");
+    // The grand product reads the permutation polynomials, which have not been read since the trace was populated
+    for (auto& polynomial : proving_key->proving_key.polynomials.get_sigmas()) {
+        polynomial.prefetch();
+    }
+    for (auto& polynomial : proving_key->proving_key.polynomials.get_ids()) {
+        polynomial.prefetch();
+    }
     // Compute the permutation and lookup grand product polynomials
     proving_key->proving_key.compute_grand_product_polynomials(proving_key->relation_parameters);
 
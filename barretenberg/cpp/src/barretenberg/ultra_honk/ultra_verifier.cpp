@@ -11,6 +11,23 @@ namespace bb {
  *
  */
 template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkProof& proof)
+{
+    const auto pairing_points = reduce_to_pairing_check(proof);
+    if (!pairing_points.has_value()) {
+        return false;
+    }
+    return verification_key->verification_key->pcs_verification_key->pairing_check((*pairing_points)[0],
+                                                                                  (*pairing_points)[1]);
+}
+
+/**
+ * @brief Verify an Ultra Honk proof up to its final pairing check, returning the points that check is over
+ * @details Used by the UltraBatchVerifier_ to share one pairing check between many proofs.
+ *
+ */
+template <typename Flavor>
+std::optional<typename UltraVerifier_<Flavor>::PairingPoints> UltraVerifier_<Flavor>::reduce_to_pairing_check(
+    const HonkProof& proof)
 {
     using FF = typename Flavor::FF;
 
@@ -25,7 +42,7 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkP
 
     DeciderVerifier decider_verifier{ verification_key, transcript };
 
-    return decider_verifier.verify();
+    return decider_verifier.reduce_to_pairing_check();
 }
 
 template class UltraVerifier_<UltraFlavor>;
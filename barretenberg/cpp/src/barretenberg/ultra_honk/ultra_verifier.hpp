@@ -18,11 +18,14 @@ template <typename Flavor> class UltraVerifier_ {
     using DeciderVerifier = DeciderVerifier_<Flavor>;
 
   public:
+    using PairingPoints = typename DeciderVerifier::PairingPoints;
+
     explicit UltraVerifier_(const std::shared_ptr<VerificationKey>& verifier_key)
         : verification_key(std::make_shared<DeciderVK>(verifier_key))
     {}
 
     bool verify_proof(const HonkProof& proof);
+    std::optional<PairingPoints> reduce_to_pairing_check(const HonkProof& proof);
 
     std::shared_ptr<Transcript> transcript{ nullptr };
     std::shared_ptr<DeciderVK> verification_key;
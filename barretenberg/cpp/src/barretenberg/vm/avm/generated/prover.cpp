@@ -1,6 +1,8 @@
 // AUTOGENERATED FILE
 #include "barretenberg/vm/avm/generated/prover.hpp"
 
+#include <algorithm>
+
 #include "barretenberg/commitment_schemes/claim.hpp"
 #include "barretenberg/commitment_schemes/commitment_key.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
@@ -62,8 +64,24 @@ void AvmProver::execute_wire_commitments_round()
     // logderivative phase)
     auto wire_polys = prover_polynomials.get_wires();
     auto labels = commitment_labels.get_wires();
-    for (size_t idx = 0; idx < wire_polys.size(); ++idx) {
-        transcript->send_to_verifier(labels[idx], commitment_key->commit_sparse(wire_polys[idx]));
+    // Most AVM columns are small or sparse, so they are committed to in batches, which batch_commit spreads over the
+    // threads by size and sparsity rather than running one multithreaded MSM per column
+    std::vector<PolynomialSpan<const FF>> batch;
+    for (size_t start = 0; start < wire_polys.size(); start += WIRE_COMMITMENT_BATCH_SIZE) {
+        const size_t end = std::min(start + WIRE_COMMITMENT_BATCH_SIZE, wire_polys.size());
+        // Read the next batch in while committing to this one, and let this one be written out afterwards
+        for (size_t idx = end; idx < std::min(end + WIRE_COMMITMENT_BATCH_SIZE, wire_polys.size()); ++idx) {
+            wire_polys[idx].prefetch();
+        }
+        batch.clear();
+        for (size_t idx = start; idx < end; ++idx) {
+            batch.emplace_back(wire_polys[idx]);
+        }
+        auto commitments = commitment_key->batch_commit(batch);
+        for (size_t idx = start; idx < end; ++idx) {
+            transcript->send_to_verifier(labels[idx], commitments[idx - start]);
+            wire_polys[idx].evict();
+        }
     }
 }
 
@@ -74,6 +92,9 @@ void AvmProver::execute_log_derivative_inverse_round()
     relation_parameters.gamma = gamm;
 
     auto prover_polynomials = ProverPolynomials(*key);
+    auto derived_polys = key->get_derived();
+    auto derived_commitments = witness_commitments.get_derived();
+    derived_committed.assign(derived_polys.size(), 0);
     std::vector<std::function<void()>> tasks;
 
     bb::constexpr_for<0, std::tuple_size_v<Flavor::LookupRelations>, 1>([&]<size_t relation_idx>() {
@@ -82,6 +103,22 @@ void AvmProver::execute_log_derivative_inverse_round()
             AVM_TRACK_TIME(std::string("prove/execute_log_derivative_inverse_round/") + Relation::NAME,
                            (compute_logderivative_inverse<Flavor, Relation>(
                                prover_polynomials, relation_parameters, key->circuit_size)));
+
+            // An inverse that is nonzero on few rows is committed to by this task straight away, overlapping with the
+            // computation of the other inverses. The others are committed to in the next round.
+            const auto& inverse = Relation::template get_inverse_polynomial(prover_polynomials);
+            const auto coeffs = inverse.coeffs();
+            const auto num_nonzero = static_cast<size_t>(
+                std::count_if(coeffs.begin(), coeffs.end(), [](const FF& coeff) { return !coeff.is_zero(); }));
+            if (num_nonzero > PCSCommitmentKey::BATCH_COMMIT_SMALL_MSM_SIZE) {
+                return;
+            }
+            for (size_t idx = 0; idx < derived_polys.size(); ++idx) {
+                if (derived_polys[idx].data() == inverse.data()) {
+                    derived_commitments[idx] = commitment_key->commit_serial(inverse);
+                    derived_committed[idx] = 1;
+                }
+            }
         });
     });
 
@@ -90,9 +127,20 @@ void AvmProver::execute_log_derivative_inverse_round()
 
 void AvmProver::execute_log_derivative_inverse_commitments_round()
 {
-    // Commit to all logderivative inverse polynomials
-    for (auto [commitment, key_poly] : zip_view(witness_commitments.get_derived(), key->get_derived())) {
-        commitment = commitment_key->commit(key_poly);
+    // Commit to the logderivative inverse polynomials that were not committed to along with their computation
+    auto derived_polys = key->get_derived();
+    auto derived_commitments = witness_commitments.get_derived();
+    std::vector<PolynomialSpan<const FF>> batch;
+    std::vector<size_t> batch_indices;
+    for (size_t idx = 0; idx < derived_polys.size(); ++idx) {
+        if (derived_committed.empty() || derived_committed[idx] == 0) {
+            batch.emplace_back(derived_polys[idx]);
+            batch_indices.emplace_back(idx);
+        }
+    }
+    auto commitments = commitment_key->batch_commit(batch);
+    for (size_t i = 0; i < batch_indices.size(); ++i) {
+        derived_commitments[batch_indices[i]] = commitments[i];
     }
 
     // Send all commitments to the verifier
@@ -126,6 +174,10 @@ void AvmProver::execute_relation_check_rounds()
  */
 void AvmProver::execute_pcs_rounds()
 {
+    // The polynomials were evicted after the first sumcheck round; read them back in ahead of the batching
+    for (auto& polynomial : prover_polynomials.get_unshifted()) {
+        polynomial.prefetch();
+    }
     auto prover_opening_claim = ZeroMorph::prove(key->circuit_size,
                                                  prover_polynomials.get_unshifted(),
                                                  prover_polynomials.get_to_be_shifted(),
@@ -58,6 +58,12 @@ class AvmProver {
     std::shared_ptr<PCSCommitmentKey> commitment_key;
 
   private:
+    // The number of wires committed to by each batch_commit call
+    static constexpr size_t WIRE_COMMITMENT_BATCH_SIZE = 128;
+
+    // Whether each logderivative inverse was committed to during execute_log_derivative_inverse_round
+    std::vector<uint8_t> derived_committed;
+
     HonkProof proof;
 };
 
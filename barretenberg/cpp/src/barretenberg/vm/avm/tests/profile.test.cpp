@@ -0,0 +1,68 @@
+#include "barretenberg/vm/avm/trace/profile.hpp"
+#include "barretenberg/vm/avm/trace/execution.hpp"
+#include "barretenberg/vm/avm/trace/instructions.hpp"
+#include "barretenberg/vm/avm/trace/opcode.hpp"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace tests_avm {
+
+using namespace bb;
+using namespace bb::avm_trace;
+
+class AvmTraceProfileTests : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        TraceProfile::get().reset();
+        TraceProfile::get().enable();
+    }
+    void TearDown() override
+    {
+        TraceProfile::get().enable(false);
+        TraceProfile::get().reset();
+    }
+
+    static std::vector<Instruction> add_program()
+    {
+        return {
+            Instruction(OpCode::SET_8, { uint8_t(0), AvmMemoryTag::U32, uint8_t(3), uint8_t(0) }),
+            Instruction(OpCode::SET_8, { uint8_t(0), AvmMemoryTag::U32, uint8_t(4), uint8_t(1) }),
+            Instruction(OpCode::ADD_8, { uint8_t(0), uint8_t(0), uint8_t(1), uint8_t(2) }),
+            Instruction(OpCode::RETURN, { uint8_t(0), uint16_t(0), uint16_t(0) }),
+        };
+    }
+};
+
+TEST_F(AvmTraceProfileTests, RecordsOpcodesAndGadgetRows)
+{
+    std::vector<FF> returndata;
+    Execution::gen_trace(add_program(), returndata, {}, Execution::getDefaultPublicInputs());
+
+    const auto& profile = TraceProfile::get();
+    EXPECT_EQ(profile.get_opcode(OpCode::SET_8).count, 2);
+    EXPECT_EQ(profile.get_opcode(OpCode::ADD_8).count, 1);
+    EXPECT_EQ(profile.get_opcode(OpCode::RETURN).count, 1);
+    EXPECT_EQ(profile.get_opcode(OpCode::MUL_8).count, 0);
+    EXPECT_EQ(profile.get_gadget_rows("alu"), 1);
+    EXPECT_GT(profile.get_gadget_rows("mem"), 0);
+
+    const std::string json = profile.to_json();
+    EXPECT_NE(json.find("\"ADD_8\":{\"count\":1,"), std::string::npos);
+    EXPECT_NE(json.find("\"finalize\""), std::string::npos);
+    EXPECT_EQ(json.find("MUL_8"), std::string::npos);
+}
+
+TEST_F(AvmTraceProfileTests, DisabledProfileRecordsNothing)
+{
+    TraceProfile::get().enable(false);
+    std::vector<FF> returndata;
+    Execution::gen_trace(add_program(), returndata, {}, Execution::getDefaultPublicInputs());
+
+    EXPECT_EQ(TraceProfile::get().get_opcode(OpCode::ADD_8).count, 0);
+    EXPECT_EQ(TraceProfile::get().get_gadget_rows("mem"), 0);
+}
+
+} // namespace tests_avm
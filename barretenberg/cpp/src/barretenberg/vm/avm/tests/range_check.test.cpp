@@ -6,6 +6,7 @@
 
 #include "barretenberg/vm/avm/trace/gadgets/range_check.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <gtest/gtest.h>
 #include <memory>
@@ -137,4 +138,38 @@ TEST(AvmRangeCheck, shouldRangeCheck)
     std::cerr << "Relations accumulated..." << std::endl;
 }
 
+TEST(AvmRangeCheck, parallelRangeChecksMatchSequential)
+{
+    // Enough events for the chunks to run on several threads
+    constexpr size_t NUM_EVENTS = 1 << 14;
+    auto value = [](size_t i) { return uint128_t(i * 7919) << (i % 64); };
+    auto num_bits = [](size_t i) { return static_cast<uint8_t>(std::min<size_t>(14 * 7 + (i % 64), 128)); };
+
+    bb::avm_trace::AvmRangeCheckBuilder sequential;
+    for (size_t i = 0; i < NUM_EVENTS; i++) {
+        sequential.assert_range(value(i), num_bits(i), EventEmitter::MEMORY, i);
+    }
+
+    bb::avm_trace::AvmRangeCheckBuilder parallel;
+    parallel.parallel_for_range_checked(
+        NUM_EVENTS, [&](size_t start, size_t end, bb::avm_trace::AvmRangeCheckBuilder& range_checks) {
+            for (size_t i = start; i < end; i++) {
+                range_checks.assert_range(value(i), num_bits(i), EventEmitter::MEMORY, i);
+            }
+        });
+
+    auto sequential_entries = sequential.finalize();
+    auto parallel_entries = parallel.finalize();
+    ASSERT_EQ(parallel_entries.size(), sequential_entries.size());
+    for (size_t i = 0; i < NUM_EVENTS; i++) {
+        EXPECT_EQ(parallel_entries[i].clk, i);
+        EXPECT_TRUE(parallel_entries[i].value == sequential_entries[i].value);
+        EXPECT_EQ(parallel_entries[i].fixed_slice_registers, sequential_entries[i].fixed_slice_registers);
+        EXPECT_EQ(parallel_entries[i].dynamic_slice_register, sequential_entries[i].dynamic_slice_register);
+    }
+    EXPECT_EQ(parallel.u16_range_chk_counters, sequential.u16_range_chk_counters);
+    EXPECT_EQ(parallel.powers_of_2_counts, sequential.powers_of_2_counts);
+    EXPECT_EQ(parallel.dyn_diff_counts, sequential.dyn_diff_counts);
+}
+
 } // namespace tests_avm
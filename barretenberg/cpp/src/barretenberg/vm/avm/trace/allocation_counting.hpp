@@ -0,0 +1,68 @@
+#pragma once
+
+/**
+ * Replaces the global operator new so that TraceProfile can count the allocations made by each opcode.
+ *
+ * CAUTION: The replacement operators are definitions, so this header must be included in exactly one translation unit
+ * of a binary, and never from a library. It does nothing in TRACY_MEMORY builds, which replace operator new themselves
+ * (see common/mem.cpp). Every allocation of the binary pays for the counter, so bb only includes it when built with
+ * AVM_PROFILE_ALLOCATIONS; avm_bench always does.
+ */
+
+#ifndef TRACY_MEMORY
+#include "barretenberg/vm/avm/trace/profile.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// GCC sees free() being called on memory from operator new once both are inlined, not knowing they are replaced
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size)
+{
+    bb::avm_trace::count_allocation();
+    // malloc(0) may return nullptr, which operator new must not
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+#ifndef __wasm__
+    throw std::bad_alloc();
+#else
+    std::abort();
+#endif
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*unused*/) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*unused*/) noexcept
+{
+    std::free(ptr);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
@@ -13,6 +13,7 @@
 #include "barretenberg/vm/avm/trace/instructions.hpp"
 #include "barretenberg/vm/avm/trace/kernel_trace.hpp"
 #include "barretenberg/vm/avm/trace/opcode.hpp"
+#include "barretenberg/vm/avm/trace/profile.hpp"
 #include "barretenberg/vm/avm/trace/trace.hpp"
 #include "barretenberg/vm/aztec_constants.hpp"
 #include "barretenberg/vm/constants.hpp"
@@ -306,6 +307,8 @@ std::vector<Row> Execution::gen_trace(std::vector<Instruction> const& instructio
     while ((pc = trace_builder.getPc()) < instructions.size()) {
         auto inst = instructions.at(pc);
         debug("[@" + std::to_string(pc) + "] " + inst.to_string());
+        // Attributes the time and allocations of the opcode to it, when profiling is enabled
+        TraceProfile::Scope opcode_scope(inst.op_code);
 
         // TODO: We do not yet support the indirect flag. Therefore we do not extract
         // inst.operands(0) (i.e. the indirect flag) when processiing the instructions.
@@ -770,7 +773,11 @@ std::vector<Row> Execution::gen_trace(std::vector<Instruction> const& instructio
         }
     }
 
-    auto trace = trace_builder.finalize();
+    std::vector<Row> trace;
+    {
+        TraceProfile::Scope finalize_scope("finalize");
+        trace = trace_builder.finalize();
+    }
     show_trace_info(trace);
     return trace;
 }
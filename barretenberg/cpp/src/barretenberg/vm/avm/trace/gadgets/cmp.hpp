@@ -4,7 +4,9 @@
 #include "barretenberg/vm/avm/generated/relations/cmp.hpp"
 #include "barretenberg/vm/avm/trace/common.hpp"
 #include "barretenberg/vm/avm/trace/gadgets/range_check.hpp"
+#include <cstddef>
 #include <cstdint>
+#include <span>
 
 enum class CmpOp { EQ, GT };
 
@@ -114,6 +116,13 @@ class AvmCmpBuilder {
     }
 
   private:
+    // A GT operation is unrolled over this many rows, an EQ one takes a single row
+    static constexpr size_t NUM_GT_ROWS = 5;
+
+    static CmpEntry finalize_event(CmpEvent const& event, AvmRangeCheckBuilder& range_checks);
+    // Writes the rows of the entry, of which there are NUM_GT_ROWS for a GT entry and 1 for an EQ entry
+    static void entry_into_canonical(CmpEntry const& entry, std::span<CmpRow> rows);
+
     std::vector<CmpEvent> cmp_events;
 };
 } // namespace bb::avm_trace
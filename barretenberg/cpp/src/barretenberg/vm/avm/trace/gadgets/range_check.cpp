@@ -1,7 +1,10 @@
 
 #include "barretenberg/vm/avm/trace/gadgets/range_check.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 namespace bb::avm_trace {
 
 /**************************************************************************************************
@@ -25,7 +28,11 @@ void AvmRangeCheckBuilder::combine_range_builders(AvmRangeCheckBuilder const& ot
     std::sort(range_check_events.begin(), range_check_events.end(), [](auto const& a, auto const& b) {
         return a.clk < b.clk;
     });
-    // Update counters
+    add_counts(other);
+}
+
+void AvmRangeCheckBuilder::add_counts(AvmRangeCheckBuilder const& other)
+{
     // U16 counters
     for (size_t i = 0; i < 8; i++) {
         const auto& row = other.u16_range_chk_counters[i];
@@ -43,68 +50,96 @@ void AvmRangeCheckBuilder::combine_range_builders(AvmRangeCheckBuilder const& ot
     }
 }
 
+void AvmRangeCheckBuilder::parallel_for_range_checked(
+    size_t num_iterations, const std::function<void(size_t, size_t, AvmRangeCheckBuilder&)>& func)
+{
+    const size_t num_chunks = calculate_num_threads(num_iterations);
+    std::vector<AvmRangeCheckBuilder> chunk_builders(num_chunks);
+    parallel_for(num_chunks, [&](size_t chunk) {
+        func(chunk * num_iterations / num_chunks, (chunk + 1) * num_iterations / num_chunks, chunk_builders[chunk]);
+    });
+    for (const auto& builder : chunk_builders) {
+        range_check_events.insert(
+            range_check_events.end(), builder.range_check_events.begin(), builder.range_check_events.end());
+    }
+}
+
 /**************************************************************************************************
  *                            FINALIZE
  **************************************************************************************************/
 // Turns range check events into real entries
 std::vector<AvmRangeCheckBuilder::RangeCheckEntry> AvmRangeCheckBuilder::finalize()
 {
-    std::vector<RangeCheckEntry> entries;
-    // Process each range check event into entries
-    for (auto& event : range_check_events) {
-        auto entry = RangeCheckEntry{};
-        // Set all the easy stuff
-        entry.clk = event.clk;
-        entry.value = event.value;
-        entry.num_bits = event.num_bits;
-        auto value_u256 = uint256_t::from_uint128(event.value);
-
-        // Now some harder stuff, split the value into 16-bit chunks
-        for (size_t i = 0; i < 8; i++) {
-            // The most significant 16-bits have to be placed in the dynamic slice register
-            if (event.num_bits <= 16) {
-                entry.dynamic_slice_register = uint16_t(value_u256);
-                u16_range_chk_counters[7][entry.dynamic_slice_register]++;
-                // Set the bit range flag at this bit range
-                entry.bit_range_flag |= 1 << i;
-                entry.dyn_bits = event.num_bits;
-                break;
-            }
-            // We have more chunks of 16-bits to operate on, so set the ith fixed register
-            entry.fixed_slice_registers[i] = uint16_t(value_u256);
-            u16_range_chk_counters[i][uint16_t(value_u256)]++;
-            event.num_bits -= 16;
-            value_u256 >>= 16;
+    std::vector<RangeCheckEntry> entries(range_check_events.size());
+    const size_t num_chunks = calculate_num_threads(entries.size(), MIN_EVENTS_PER_CHUNK);
+    // Only the counters of these builders are used
+    std::vector<AvmRangeCheckBuilder> chunk_counters(num_chunks);
+    parallel_for(num_chunks, [&](size_t chunk) {
+        const size_t start = chunk * entries.size() / num_chunks;
+        const size_t end = (chunk + 1) * entries.size() / num_chunks;
+        for (size_t i = start; i < end; i++) {
+            entries[i] = chunk_counters[chunk].finalize_event(range_check_events[i]);
         }
+    });
+    for (const auto& counters : chunk_counters) {
+        add_counts(counters);
+    }
+    return entries;
+}
 
-        // Update the other counters
-        powers_of_2_counts[uint8_t(entry.dyn_bits)]++;
-        auto dyn_diff = uint16_t((1 << entry.dyn_bits) - entry.dynamic_slice_register - 1);
-        entry.dyn_diff = dyn_diff;
-        dyn_diff_counts[dyn_diff]++;
+AvmRangeCheckBuilder::RangeCheckEntry AvmRangeCheckBuilder::finalize_event(RangeCheckEvent& event)
+{
+    auto entry = RangeCheckEntry{};
+    // Set all the easy stuff
+    entry.clk = event.clk;
+    entry.value = event.value;
+    entry.num_bits = event.num_bits;
+    auto value_u256 = uint256_t::from_uint128(event.value);
 
-        switch (event.emitter) {
-        case EventEmitter::ALU:
-            entry.is_alu_sel = true;
-            break;
-        case EventEmitter::MEMORY:
-            entry.is_mem_sel = true;
-            break;
-        case EventEmitter::GAS_L2:
-            entry.is_gas_l2_sel = true;
-            break;
-        case EventEmitter::GAS_DA:
-            entry.is_gas_da_sel = true;
-            break;
-        case EventEmitter::CMP_LO:
-            entry.is_cmp_lo = true;
-            break;
-        case EventEmitter::CMP_HI:
-            entry.is_cmp_hi = true;
+    // Now some harder stuff, split the value into 16-bit chunks
+    for (size_t i = 0; i < 8; i++) {
+        // The most significant 16-bits have to be placed in the dynamic slice register
+        if (event.num_bits <= 16) {
+            entry.dynamic_slice_register = uint16_t(value_u256);
+            u16_range_chk_counters[7][entry.dynamic_slice_register]++;
+            // Set the bit range flag at this bit range
+            entry.bit_range_flag |= 1 << i;
+            entry.dyn_bits = event.num_bits;
             break;
         }
-        entries.push_back(entry);
+        // We have more chunks of 16-bits to operate on, so set the ith fixed register
+        entry.fixed_slice_registers[i] = uint16_t(value_u256);
+        u16_range_chk_counters[i][uint16_t(value_u256)]++;
+        event.num_bits -= 16;
+        value_u256 >>= 16;
     }
-    return entries;
+
+    // Update the other counters
+    powers_of_2_counts[uint8_t(entry.dyn_bits)]++;
+    auto dyn_diff = uint16_t((1 << entry.dyn_bits) - entry.dynamic_slice_register - 1);
+    entry.dyn_diff = dyn_diff;
+    dyn_diff_counts[dyn_diff]++;
+
+    switch (event.emitter) {
+    case EventEmitter::ALU:
+        entry.is_alu_sel = true;
+        break;
+    case EventEmitter::MEMORY:
+        entry.is_mem_sel = true;
+        break;
+    case EventEmitter::GAS_L2:
+        entry.is_gas_l2_sel = true;
+        break;
+    case EventEmitter::GAS_DA:
+        entry.is_gas_da_sel = true;
+        break;
+    case EventEmitter::CMP_LO:
+        entry.is_cmp_lo = true;
+        break;
+    case EventEmitter::CMP_HI:
+        entry.is_cmp_hi = true;
+        break;
+    }
+    return entry;
 }
 } // namespace bb::avm_trace
@@ -3,7 +3,10 @@
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/vm/avm/generated/relations/range_check.hpp"
 #include "barretenberg/vm/avm/trace/common.hpp"
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <vector>
 
 enum class EventEmitter { ALU, MEMORY, GAS_L2, GAS_DA, CMP_LO, CMP_HI };
 
@@ -52,7 +55,16 @@ class AvmRangeCheckBuilder {
 
     void combine_range_builders(AvmRangeCheckBuilder const& other);
 
-    // Turns range check events into real entries
+    /**
+     * @brief Runs func over chunks of [0, num_iterations) in parallel. Each chunk asserts its range checks into a
+     * builder of its own, whose events are then appended to this builder in chunk order, so that the events are the
+     * same as those of a sequential run. func must only call assert_range on the builder it is given.
+     */
+    void parallel_for_range_checked(size_t num_iterations,
+                                    const std::function<void(size_t, size_t, AvmRangeCheckBuilder&)>& func);
+
+    // Turns range check events into real entries. The events are processed in parallel chunks, each counting into
+    // counters of its own which are then summed, so the entries and counts do not depend on the number of threads.
     std::vector<RangeCheckEntry> finalize();
 
     template <typename DestRow> void merge_into(DestRow& row, RangeCheckEntry const& entry)
@@ -100,6 +112,12 @@ class AvmRangeCheckBuilder {
     }
 
   private:
+    // Events are processed in chunks of at least this many, as each chunk needs its own counters
+    static constexpr size_t MIN_EVENTS_PER_CHUNK = 1 << 12;
+
+    RangeCheckEntry finalize_event(RangeCheckEvent& event);
+    void add_counts(AvmRangeCheckBuilder const& other);
+
     std::vector<RangeCheckEvent> range_check_events;
 };
 } // namespace bb::avm_trace
@@ -0,0 +1,122 @@
+#include "barretenberg/vm/avm/trace/profile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+namespace bb::avm_trace {
+
+namespace {
+thread_local uint64_t num_allocations = 0;
+
+void write_profile(std::ostringstream& out, const TraceProfile::OpcodeProfile& profile)
+{
+    out << "{\"count\":" << profile.count << ",\"time_ns\":" << profile.time_ns
+        << ",\"allocations\":" << profile.allocations << "}";
+}
+} // namespace
+
+void count_allocation()
+{
+    num_allocations++;
+}
+
+uint64_t get_num_allocations()
+{
+    return num_allocations;
+}
+
+TraceProfile& TraceProfile::get()
+{
+    static TraceProfile profile;
+    return profile;
+}
+
+void TraceProfile::reset()
+{
+    std::lock_guard lock(mutex);
+    opcodes.fill({});
+    gadget_rows.clear();
+    phases.clear();
+}
+
+void TraceProfile::record_opcode(OpCode opcode, uint64_t time_ns, uint64_t allocations)
+{
+    std::lock_guard lock(mutex);
+    auto& profile = opcodes.at(static_cast<size_t>(opcode));
+    profile.count++;
+    profile.time_ns += time_ns;
+    profile.allocations += allocations;
+}
+
+void TraceProfile::record_gadget_rows(const std::string& gadget, size_t rows)
+{
+    if (!is_enabled()) {
+        return;
+    }
+    std::lock_guard lock(mutex);
+    gadget_rows[gadget] += rows;
+}
+
+void TraceProfile::record_phase(const std::string& phase, uint64_t time_ns, uint64_t allocations)
+{
+    if (!is_enabled()) {
+        return;
+    }
+    std::lock_guard lock(mutex);
+    auto& profile = phases[phase];
+    profile.count++;
+    profile.time_ns += time_ns;
+    profile.allocations += allocations;
+}
+
+size_t TraceProfile::get_gadget_rows(const std::string& gadget) const
+{
+    std::lock_guard lock(mutex);
+    auto it = gadget_rows.find(gadget);
+    return it == gadget_rows.end() ? 0 : it->second;
+}
+
+std::string TraceProfile::to_json() const
+{
+    std::lock_guard lock(mutex);
+    std::ostringstream out;
+    OpcodeProfile total;
+
+    out << "{\"opcodes\":{";
+    bool first = true;
+    for (size_t i = 0; i < opcodes.size(); i++) {
+        const auto& profile = opcodes[i];
+        if (profile.count == 0) {
+            continue;
+        }
+        out << (first ? "" : ",") << "\"" << to_string(static_cast<OpCode>(i)) << "\":";
+        write_profile(out, profile);
+        total.count += profile.count;
+        total.time_ns += profile.time_ns;
+        total.allocations += profile.allocations;
+        first = false;
+    }
+    out << "},\"total\":";
+    write_profile(out, total);
+
+    out << ",\"phases\":{";
+    first = true;
+    for (const auto& [phase, profile] : phases) {
+        out << (first ? "" : ",") << "\"" << phase << "\":";
+        write_profile(out, profile);
+        first = false;
+    }
+
+    out << "},\"gadget_rows\":{";
+    first = true;
+    for (const auto& [gadget, rows] : gadget_rows) {
+        out << (first ? "" : ",") << "\"" << gadget << "\":" << rows;
+        first = false;
+    }
+    out << "}}";
+    return out.str();
+}
+
+} // namespace bb::avm_trace
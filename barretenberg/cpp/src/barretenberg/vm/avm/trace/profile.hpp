@@ -0,0 +1,122 @@
+#pragma once
+
+#include "barretenberg/vm/avm/trace/opcode.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace bb::avm_trace {
+
+// Counts an allocation made on the calling thread. Only called by the counting operator new of
+// allocation_counting.hpp, so the count stays at zero in binaries that do not include it (e.g. bb, unless it is built
+// with AVM_PROFILE_ALLOCATIONS).
+void count_allocation();
+// The number of allocations made on the calling thread so far
+uint64_t get_num_allocations();
+
+/**
+ * @brief A profile of trace generation, split by opcode and by gadget
+ *
+ * @details Unlike Stats, the profile is kept in release builds and enabled at runtime, so that it can be taken from
+ * the binaries we actually run. When it is disabled, each opcode only costs a relaxed load of the enabled flag.
+ *
+ * For each opcode it records how often it was executed, the time spent in its trace builder call, and the number of
+ * allocations that call made. For each gadget it records the number of rows it emitted into the trace.
+ */
+class TraceProfile {
+  public:
+    struct OpcodeProfile {
+        uint64_t count = 0;
+        uint64_t time_ns = 0;
+        uint64_t allocations = 0;
+    };
+
+    /**
+     * @brief Records the time and allocations of an opcode, or of a phase of trace generation, from its construction
+     * to its destruction
+     */
+    class Scope {
+      public:
+        explicit Scope(OpCode opcode)
+            : opcode(opcode)
+        {
+            start_recording();
+        }
+        explicit Scope(std::string phase)
+            : phase(std::move(phase))
+        {
+            start_recording();
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(Scope&&) = delete;
+        ~Scope()
+        {
+            if (!enabled) {
+                return;
+            }
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            auto time_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+            uint64_t allocations = get_num_allocations() - start_allocations;
+            if (phase.empty()) {
+                TraceProfile::get().record_opcode(opcode, time_ns, allocations);
+            } else {
+                TraceProfile::get().record_phase(phase, time_ns, allocations);
+            }
+        }
+
+      private:
+        void start_recording()
+        {
+            enabled = TraceProfile::get().is_enabled();
+            if (enabled) {
+                start_allocations = get_num_allocations();
+                start = std::chrono::steady_clock::now();
+            }
+        }
+
+        OpCode opcode = OpCode::LAST_OPCODE_SENTINEL;
+        std::string phase;
+        bool enabled = false;
+        uint64_t start_allocations = 0;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    static TraceProfile& get();
+
+    void enable(bool value = true) { enabled.store(value, std::memory_order_relaxed); }
+    bool is_enabled() const { return enabled.load(std::memory_order_relaxed); }
+    void reset();
+
+    void record_opcode(OpCode opcode, uint64_t time_ns, uint64_t allocations);
+    void record_gadget_rows(const std::string& gadget, size_t rows);
+    // Records a phase of trace generation that is not attributed to an opcode, e.g. finalisation
+    void record_phase(const std::string& phase, uint64_t time_ns, uint64_t allocations);
+
+    const OpcodeProfile& get_opcode(OpCode opcode) const { return opcodes.at(static_cast<size_t>(opcode)); }
+    size_t get_gadget_rows(const std::string& gadget) const;
+
+    /**
+     * @brief The profile as JSON, with an entry per executed opcode, per gadget and per phase
+     */
+    std::string to_json() const;
+
+  private:
+    TraceProfile() = default;
+
+    std::atomic<bool> enabled = false;
+    std::array<OpcodeProfile, static_cast<size_t>(OpCode::LAST_OPCODE_SENTINEL)> opcodes{};
+    std::map<std::string, size_t> gadget_rows;
+    std::map<std::string, OpcodeProfile> phases;
+    mutable std::mutex mutex;
+};
+
+} // namespace bb::avm_trace
@@ -30,6 +30,7 @@
 #include "barretenberg/vm/avm/trace/gadgets/slice_trace.hpp"
 #include "barretenberg/vm/avm/trace/helper.hpp"
 #include "barretenberg/vm/avm/trace/opcode.hpp"
+#include "barretenberg/vm/avm/trace/profile.hpp"
 #include "barretenberg/vm/avm/trace/trace.hpp"
 #include "barretenberg/vm/stats.hpp"
 
@@ -3484,112 +3485,117 @@ std::vector<Row> AvmTraceBuilder::finalize()
      * MEMORY TRACE INCLUSION
      **********************************************************************************************/
 
-    // We compute in the main loop the timestamp and global address for next row.
-    // Perform initialization for index 0 outside of the loop provided that mem trace exists.
-    if (mem_trace_size > 0) {
-        main_trace.at(0).mem_tsp =
-            FF(AvmMemTraceBuilder::NUM_SUB_CLK * mem_trace.at(0).m_clk + mem_trace.at(0).m_sub_clk);
-
-        main_trace.at(0).mem_glob_addr =
-            FF(mem_trace.at(0).m_addr + (static_cast<uint64_t>(mem_trace.at(0).m_space_id) << 32));
-    }
-
-    for (size_t i = 0; i < mem_trace_size; i++) {
-        auto const& src = mem_trace.at(i);
-        auto& dest = main_trace.at(i);
-
-        dest.mem_sel_mem = FF(1);
-        dest.mem_clk = FF(src.m_clk);
-        dest.mem_addr = FF(src.m_addr);
-        dest.mem_space_id = FF(src.m_space_id);
-        dest.mem_val = src.m_val;
-        dest.mem_rw = FF(static_cast<uint32_t>(src.m_rw));
-        dest.mem_r_in_tag = FF(static_cast<uint32_t>(src.r_in_tag));
-        dest.mem_w_in_tag = FF(static_cast<uint32_t>(src.w_in_tag));
-        dest.mem_tag = FF(static_cast<uint32_t>(src.m_tag));
-        dest.mem_tag_err = FF(static_cast<uint32_t>(src.m_tag_err));
-        dest.mem_one_min_inv = src.m_one_min_inv;
-        dest.mem_sel_mov_ia_to_ic = FF(static_cast<uint32_t>(src.m_sel_mov_ia_to_ic));
-        dest.mem_sel_mov_ib_to_ic = FF(static_cast<uint32_t>(src.m_sel_mov_ib_to_ic));
-        dest.mem_sel_op_slice = FF(static_cast<uint32_t>(src.m_sel_op_slice));
-
-        dest.incl_mem_tag_err_counts = FF(static_cast<uint32_t>(src.m_tag_err_count_relevant));
-
-        // TODO: Should be a cleaner way to do this in the future. Perhaps an "into_canoncal" function in
-        // mem_trace_builder
-        if (!src.m_sel_op_slice) {
-            switch (src.m_sub_clk) {
-            case AvmMemTraceBuilder::SUB_CLK_LOAD_A:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_a = 1 : dest.mem_sel_op_a = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_STORE_A:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_a = 1 : dest.mem_sel_op_a = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_LOAD_B:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_b = 1 : dest.mem_sel_op_b = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_STORE_B:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_b = 1 : dest.mem_sel_op_b = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_LOAD_C:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_c = 1 : dest.mem_sel_op_c = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_STORE_C:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_c = 1 : dest.mem_sel_op_c = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_LOAD_D:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_d = 1 : dest.mem_sel_op_d = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_STORE_D:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_d = 1 : dest.mem_sel_op_d = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_A:
-                dest.mem_sel_resolve_ind_addr_a = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_B:
-                dest.mem_sel_resolve_ind_addr_b = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_C:
-                dest.mem_sel_resolve_ind_addr_c = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_D:
-                dest.mem_sel_resolve_ind_addr_d = 1;
-                break;
-            default:
-                break;
-            }
-        }
-
-        if (src.m_sel_op_slice) {
-            dest.mem_skip_check_tag = dest.mem_sel_op_b * (-dest.mem_sel_mov_ib_to_ic + 1) + dest.mem_sel_op_slice;
-        }
+    auto mem_tsp = [](auto const& entry) {
+        return FF(AvmMemTraceBuilder::NUM_SUB_CLK * entry.m_clk + entry.m_sub_clk);
+    };
+    auto mem_glob_addr = [](auto const& entry) {
+        return FF(entry.m_addr + (static_cast<uint64_t>(entry.m_space_id) << 32));
+    };
 
-        if (i + 1 < mem_trace_size) {
-            auto const& next = mem_trace.at(i + 1);
-            auto& dest_next = main_trace.at(i + 1);
-            dest_next.mem_tsp = FF(AvmMemTraceBuilder::NUM_SUB_CLK * next.m_clk + next.m_sub_clk);
-            dest_next.mem_glob_addr = FF(next.m_addr + (static_cast<uint64_t>(next.m_space_id) << 32));
-
-            FF diff{};
-            if (dest_next.mem_glob_addr == dest.mem_glob_addr) {
-                diff = dest_next.mem_tsp - dest.mem_tsp;
-            } else {
-                diff = dest_next.mem_glob_addr - dest.mem_glob_addr;
-                dest.mem_lastAccess = FF(1);
+    // Each row only depends on its own entry and the next one, so the rows are filled in parallel chunks. The range
+    // checks of the chunks are appended in order, as if the rows had been filled sequentially.
+    range_check_builder.parallel_for_range_checked(
+        mem_trace_size, [&](size_t start, size_t end, AvmRangeCheckBuilder& range_checks) {
+            for (size_t i = start; i < end; i++) {
+                auto const& src = mem_trace.at(i);
+                auto& dest = main_trace.at(i);
+
+                dest.mem_sel_mem = FF(1);
+                dest.mem_tsp = mem_tsp(src);
+                dest.mem_glob_addr = mem_glob_addr(src);
+                dest.mem_clk = FF(src.m_clk);
+                dest.mem_addr = FF(src.m_addr);
+                dest.mem_space_id = FF(src.m_space_id);
+                dest.mem_val = src.m_val;
+                dest.mem_rw = FF(static_cast<uint32_t>(src.m_rw));
+                dest.mem_r_in_tag = FF(static_cast<uint32_t>(src.r_in_tag));
+                dest.mem_w_in_tag = FF(static_cast<uint32_t>(src.w_in_tag));
+                dest.mem_tag = FF(static_cast<uint32_t>(src.m_tag));
+                dest.mem_tag_err = FF(static_cast<uint32_t>(src.m_tag_err));
+                dest.mem_one_min_inv = src.m_one_min_inv;
+                dest.mem_sel_mov_ia_to_ic = FF(static_cast<uint32_t>(src.m_sel_mov_ia_to_ic));
+                dest.mem_sel_mov_ib_to_ic = FF(static_cast<uint32_t>(src.m_sel_mov_ib_to_ic));
+                dest.mem_sel_op_slice = FF(static_cast<uint32_t>(src.m_sel_op_slice));
+
+                dest.incl_mem_tag_err_counts = FF(static_cast<uint32_t>(src.m_tag_err_count_relevant));
+
+                // TODO: Should be a cleaner way to do this in the future. Perhaps an "into_canoncal" function in
+                // mem_trace_builder
+                if (!src.m_sel_op_slice) {
+                    switch (src.m_sub_clk) {
+                    case AvmMemTraceBuilder::SUB_CLK_LOAD_A:
+                        src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_a = 1 : dest.mem_sel_op_a = 1;
+                        break;
+                    case AvmMemTraceBuilder::SUB_CLK_STORE_A:
+                        src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_a = 1 : dest.mem_sel_op_a = 1;
+                        break;
+                    case AvmMemTraceBuilder::SUB_CLK_LOAD_B:
+                        src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_b = 1 : dest.mem_sel_op_b = 1;
+                        break;
+                    case AvmMemTraceBuilder::SUB_CLK_STORE_B:
+                        src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_b = 1 : dest.mem_sel_op_b = 1;
+                        break;
+                    case AvmMemTraceBuilder::SUB_CLK_LOAD_C:
+                        src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_c = 1 : dest.mem_sel_op_c = 1;
+                        break;
+                    case AvmMemTraceBuilder::SUB_CLK_STORE_C:
+                        src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_c = 1 : dest.mem_sel_op_c = 1;
+                        break;
+                    case AvmMemTraceBuilder::SUB_CLK_LOAD_D:
+                        src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_d = 1 : dest.mem_sel_op_d = 1;
+                        break;
+                    case AvmMemTraceBuilder::SUB_CLK_STORE_D:
+                        src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_d = 1 : dest.mem_sel_op_d = 1;
+                        break;
+                    case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_A:
+                        dest.mem_sel_resolve_ind_addr_a = 1;
+                        break;
+                    case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_B:
+                        dest.mem_sel_resolve_ind_addr_b = 1;
+                        break;
+                    case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_C:
+                        dest.mem_sel_resolve_ind_addr_c = 1;
+                        break;
+                    case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_D:
+                        dest.mem_sel_resolve_ind_addr_d = 1;
+                        break;
+                    default:
+                        break;
+                    }
+                }
+
+                if (src.m_sel_op_slice) {
+                    dest.mem_skip_check_tag =
+                        dest.mem_sel_op_b * (-dest.mem_sel_mov_ib_to_ic + 1) + dest.mem_sel_op_slice;
+                }
+
+                if (i + 1 < mem_trace_size) {
+                    auto const& next = mem_trace.at(i + 1);
+                    const FF next_tsp = mem_tsp(next);
+                    const FF next_glob_addr = mem_glob_addr(next);
+
+                    FF diff{};
+                    if (next_glob_addr == dest.mem_glob_addr) {
+                        diff = next_tsp - dest.mem_tsp;
+                    } else {
+                        diff = next_glob_addr - dest.mem_glob_addr;
+                        dest.mem_lastAccess = FF(1);
+                    }
+                    dest.mem_sel_rng_chk = FF(1);
+
+                    // Decomposition of diff
+                    dest.mem_diff = uint64_t(diff);
+                    // It's not great that this happens here, but we can clean it up after we extract the range
+                    // checks. Mem Address row differences are range checked to 40 bits, and the inter-trace index
+                    // is the timestamp
+                    range_checks.assert_range(uint128_t(diff), 40, EventEmitter::MEMORY, uint64_t(dest.mem_tsp));
+
+                } else {
+                    dest.mem_lastAccess = FF(1);
+                    dest.mem_last = FF(1);
+                }
             }
-            dest.mem_sel_rng_chk = FF(1);
-
-            // Decomposition of diff
-            dest.mem_diff = uint64_t(diff);
-            // It's not great that this happens here, but we can clean it up after we extract the range checks
-            // Mem Address row differences are range checked to 40 bits, and the inter-trace index is the timestamp
-            range_check_builder.assert_range(uint128_t(diff), 40, EventEmitter::MEMORY, uint64_t(dest.mem_tsp));
-
-        } else {
-            dest.mem_lastAccess = FF(1);
-            dest.mem_last = FF(1);
-        }
-    }
+        });
 
     /**********************************************************************************************
      * ALU TRACE INCLUSION
@@ -3878,6 +3884,22 @@ std::vector<Row> AvmTraceBuilder::finalize()
           KERNEL_OUTPUTS_LENGTH,
           "\n\tcalldata_size: ",
           calldata.size());
+
+    auto& profile = TraceProfile::get();
+    profile.record_gadget_rows("main", main_trace_size_pre_padding);
+    profile.record_gadget_rows("mem", mem_trace_size);
+    profile.record_gadget_rows("alu", alu_trace_size);
+    profile.record_gadget_rows("cmp", cmp_trace_size);
+    profile.record_gadget_rows("range_check", range_entries.size());
+    profile.record_gadget_rows("binary", bin_trace_size);
+    profile.record_gadget_rows("conversion", conv_trace_size);
+    profile.record_gadget_rows("sha256", sha256_trace_size);
+    profile.record_gadget_rows("poseidon2", poseidon2_trace_size);
+    profile.record_gadget_rows("keccak", keccak_trace_size);
+    profile.record_gadget_rows("pedersen", pedersen_trace_size);
+    profile.record_gadget_rows("gas", gas_trace_size);
+    profile.record_gadget_rows("slice", slice_trace_size);
+    profile.record_gadget_rows("kernel", kernel_trace_size);
     reset();
 
     return trace;
@@ -37,11 +37,30 @@ struct WorldStateRevision {
     static WorldStateRevision uncommitted() { return WorldStateRevision{ .includeUncommitted = true }; }
 };
 
+/**
+ * @brief Wall-clock time in microseconds spent in each stage of syncing a block
+ *
+ * @details Each tree is checked against the block as soon as its insertions are done, overlapping the insertions into
+ * the other trees. insertionTimeUs covers the insertions and these checks, commitTimeUs the commit of all the trees once
+ * the whole block has been validated.
+ */
+struct WorldStateSyncTimings {
+    uint64_t rollbackTimeUs{ 0 };
+    uint64_t insertionTimeUs{ 0 };
+    uint64_t commitTimeUs{ 0 };
+    uint64_t totalTimeUs{ 0 };
+    // The number of insertions the public writes were applied in, after merging batches without common slots
+    uint64_t publicWriteBatches{ 0 };
+    MSGPACK_FIELDS(rollbackTimeUs, insertionTimeUs, commitTimeUs, totalTimeUs, publicWriteBatches);
+};
+
 struct WorldStateStatus {
     index_t unfinalisedBlockNumber;
     index_t finalisedBlockNumber;
     index_t oldestHistoricalBlock;
-    MSGPACK_FIELDS(unfinalisedBlockNumber, finalisedBlockNumber, oldestHistoricalBlock);
+    // Only populated by sync_block
+    WorldStateSyncTimings syncTimings;
+    MSGPACK_FIELDS(unfinalisedBlockNumber, finalisedBlockNumber, oldestHistoricalBlock, syncTimings);
 
     bool operator==(const WorldStateStatus& other) const
     {
@@ -1,4 +1,5 @@
 #include "barretenberg/world_state/world_state.hpp"
+#include "barretenberg/common/timer.hpp"
 #include "barretenberg/crypto/merkle_tree/append_only_tree/content_addressed_append_only_tree.hpp"
 #include "barretenberg/crypto/merkle_tree/hash.hpp"
 #include "barretenberg/crypto/merkle_tree/hash_path.hpp"
@@ -25,6 +26,7 @@
 #include <stdexcept>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <variant>
 
@@ -190,6 +192,57 @@ void WorldState::delete_fork(const uint64_t& forkId)
 }
 
 Fork::SharedPtr WorldState::create_new_fork(const index_t& blockNumber)
+{
+    // Forking from the persisted stores reads their meta and block data and computes the trees' zero hashes. Do that
+    // once per block and snapshot the resulting fork, which is never written to, for the following forks at the block.
+    Fork::SharedPtr fork_template;
+    uint64_t generation = 0;
+    {
+        std::unique_lock lock(mtx);
+        auto it = _fork_templates.find(blockNumber);
+        if (it != _fork_templates.end()) {
+            fork_template = it->second;
+        }
+        generation = _fork_templates_generation;
+    }
+    if (fork_template == nullptr) {
+        fork_template = initialise_fork(blockNumber);
+        std::unique_lock lock(mtx);
+        // Don't keep the template if the canonical state changed while it was being created
+        if (generation == _fork_templates_generation) {
+            fork_template = _fork_templates.try_emplace(blockNumber, fork_template).first->second;
+        }
+    }
+    return snapshot_fork(*fork_template);
+}
+
+Fork::SharedPtr WorldState::snapshot_fork(const Fork& fork)
+{
+    Fork::SharedPtr snapshot = std::make_shared<Fork>();
+    snapshot->_blockNumber = fork._blockNumber;
+    for (const auto& entry : fork._trees) {
+        const MerkleTreeId id = entry.first;
+        std::visit(
+            [&, id](auto&& wrapper) {
+                snapshot->_trees.insert({ id, TreeWithStore(wrapper.tree->create_snapshot()) });
+            },
+            entry.second);
+    }
+    return snapshot;
+}
+
+void WorldState::clear_fork_templates()
+{
+    // As with the forks, destroy the templates outside of the lock
+    std::unordered_map<index_t, Fork::SharedPtr> templates;
+    {
+        std::unique_lock lock(mtx);
+        templates.swap(_fork_templates);
+        ++_fork_templates_generation;
+    }
+}
+
+Fork::SharedPtr WorldState::initialise_fork(const index_t& blockNumber)
 {
     Fork::SharedPtr fork = std::make_shared<Fork>();
     fork->_blockNumber = blockNumber;
@@ -346,6 +399,38 @@ fr_sibling_path WorldState::get_sibling_path(const WorldStateRevision& revision,
         fork->_trees.at(tree_id));
 }
 
+std::vector<fr_sibling_path> WorldState::get_sibling_paths(const WorldStateRevision& revision,
+                                                          MerkleTreeId tree_id,
+                                                          const std::vector<index_t>& leaf_indices) const
+{
+    Fork::SharedPtr fork = retrieve_fork(revision.forkId);
+
+    return std::visit(
+        [&leaf_indices, revision](auto&& wrapper) {
+            Signal signal(1);
+            TypedResponse<GetSiblingPathsResponse> response;
+
+            auto callback = [&signal, &response](const TypedResponse<GetSiblingPathsResponse>& r) {
+                response = r;
+                signal.signal_level(0);
+            };
+
+            if (revision.blockNumber) {
+                wrapper.tree->get_sibling_paths(
+                    leaf_indices, revision.blockNumber, callback, revision.includeUncommitted);
+            } else {
+                wrapper.tree->get_sibling_paths(leaf_indices, callback, revision.includeUncommitted);
+            }
+            signal.wait_for_level(0);
+
+            if (!response.success) {
+                throw std::runtime_error("Failed to get sibling paths: " + response.message);
+            }
+            return response.inner.paths;
+        },
+        fork->_trees.at(tree_id));
+}
+
 void WorldState::update_public_data(const PublicDataLeafValue& new_value, Fork::Id fork_id)
 {
     Fork::SharedPtr fork = retrieve_fork(fork_id);
@@ -390,6 +475,7 @@ bool WorldState::commit()
     }
 
     signal.wait_for_level(0);
+    clear_fork_templates();
     return success;
 }
 
@@ -408,6 +494,36 @@ void WorldState::rollback()
     signal.wait_for_level();
 }
 
+std::vector<std::vector<PublicDataLeafValue>> WorldState::merge_public_write_batches(
+    const std::vector<std::vector<PublicDataLeafValue>>& public_writes)
+{
+    // Leaves are appended in the order of the values given, whether or not they are split into batches, and the low
+    // leaf updates of writes to different slots do not depend on the order they are made in. So consecutive batches
+    // writing to different slots can be inserted together.
+    std::vector<std::vector<PublicDataLeafValue>> merged;
+    std::unordered_set<fr> slots;
+    for (const auto& batch : public_writes) {
+        bool conflicts = merged.empty();
+        for (const auto& write : batch) {
+            if (!write.is_empty() && slots.contains(write.slot)) {
+                conflicts = true;
+                break;
+            }
+        }
+        if (conflicts) {
+            merged.emplace_back();
+            slots.clear();
+        }
+        merged.back().insert(merged.back().end(), batch.begin(), batch.end());
+        for (const auto& write : batch) {
+            if (!write.is_empty()) {
+                slots.insert(write.slot);
+            }
+        }
+    }
+    return merged;
+}
+
 WorldStateStatus WorldState::sync_block(
     const StateReference& block_state_ref,
     const bb::fr& block_header_hash,
@@ -416,93 +532,133 @@ WorldStateStatus WorldState::sync_block(
     const std::vector<crypto::merkle_tree::NullifierLeafValue>& nullifiers,
     const std::vector<std::vector<crypto::merkle_tree::PublicDataLeafValue>>& public_writes)
 {
+    Timer total_timer;
     WorldStateStatus status;
     if (is_same_state_reference(WorldStateRevision::uncommitted(), block_state_ref) &&
         is_archive_tip(WorldStateRevision::uncommitted(), block_header_hash)) {
+        Timer commit_timer;
         if (!commit()) {
             throw std::runtime_error("Commit failed");
         }
         get_status(status);
+        status.syncTimings.commitTimeUs = static_cast<uint64_t>(commit_timer.nanoseconds() / 1000);
+        status.syncTimings.totalTimeUs = static_cast<uint64_t>(total_timer.nanoseconds() / 1000);
         return status;
     }
+    Timer rollback_timer;
     rollback();
+    get_status(status);
+    status.syncTimings.rollbackTimeUs = static_cast<uint64_t>(rollback_timer.nanoseconds() / 1000);
+
+    // insert public writes in batches so that we can have different transactions modifying the same slot in the
+    // same L2 block
+    const auto public_write_batches = merge_public_write_batches(public_writes);
+    status.syncTimings.publicWriteBatches = public_write_batches.size();
 
     Fork::SharedPtr fork = retrieve_fork(CANONICAL_FORK_ID);
     Signal signal(static_cast<uint32_t>(fork->_trees.size()));
-    std::atomic_bool success = true;
+    std::mutex sync_mutex;
+    bool success = true;
     std::string err_message;
-    auto decr = [&signal, &success, &err_message](const auto& resp) {
+    Timer insertion_timer;
+
+    auto fail = [&](const std::string& message) {
         // take the first error
-        bool expected = true;
-        if (!resp.success && success.compare_exchange_strong(expected, false)) {
-            err_message = resp.message;
+        std::lock_guard<std::mutex> lock(sync_mutex);
+        if (success) {
+            success = false;
+            err_message = message;
         }
+    };
 
-        signal.signal_decrement();
+    // Once the block has been inserted into a tree, check the tree against the block's state reference straight away,
+    // so that the check overlaps the insertions into the other trees. Nothing is committed until every tree has been
+    // checked.
+    auto check_tree = [&](MerkleTreeId id, bool inserted, const std::string& message) {
+        if (!inserted) {
+            fail("Failed to sync block: " + message);
+            signal.signal_decrement();
+            return;
+        }
+        std::visit(
+            [&, id](auto&& wrapper) {
+                wrapper.tree->get_meta_data(true, [&, id](const TypedResponse<TreeMetaResponse>& meta) {
+                    auto expected = block_state_ref.find(id);
+                    if (!meta.success) {
+                        fail("Failed to sync block: " + meta.message);
+                    } else if (expected != block_state_ref.end() &&
+                               expected->second != TreeStateReference(meta.inner.meta.root, meta.inner.meta.size)) {
+                        fail("Can't synch block: block state does not match world state");
+                    }
+                    signal.signal_decrement();
+                });
+            },
+            fork->_trees.at(id));
     };
 
     {
         auto& wrapper = std::get<TreeWithStore<NullifierTree>>(fork->_trees.at(MerkleTreeId::NULLIFIER_TREE));
-        NullifierTree::AddCompletionCallback completion = [&](const auto&) -> void { signal.signal_decrement(); };
+        NullifierTree::AddCompletionCallback completion = [&](const auto& resp) -> void {
+            check_tree(MerkleTreeId::NULLIFIER_TREE, resp.success, resp.message);
+        };
         wrapper.tree->add_or_update_values(nullifiers, 0, completion);
     }
 
-    {
-        auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(MerkleTreeId::NOTE_HASH_TREE));
-        wrapper.tree->add_values(notes, decr);
-    }
-
-    {
-        auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(MerkleTreeId::L1_TO_L2_MESSAGE_TREE));
-        wrapper.tree->add_values(l1_to_l2_messages, decr);
+    for (const auto& entry : { std::make_pair(MerkleTreeId::NOTE_HASH_TREE, &notes),
+                               std::make_pair(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, &l1_to_l2_messages) }) {
+        const MerkleTreeId id = entry.first;
+        auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(id));
+        wrapper.tree->add_values(*entry.second,
+                                 [&, id](const auto& resp) { check_tree(id, resp.success, resp.message); });
     }
 
     {
         auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(MerkleTreeId::ARCHIVE));
-        wrapper.tree->add_value(block_header_hash, decr);
+        wrapper.tree->add_value(block_header_hash, [&](const auto& resp) {
+            check_tree(MerkleTreeId::ARCHIVE, resp.success, resp.message);
+        });
     }
 
     // finally insert the public writes and wait for all the operations to end
     {
-        // insert public writes in batches so that we can have different transactions modifying the same slot in the
-        // same L2 block
         auto& wrapper = std::get<TreeWithStore<PublicDataTree>>(fork->_trees.at(MerkleTreeId::PUBLIC_DATA_TREE));
-        std::atomic_uint64_t current_batch = 0;
+        size_t current_batch = 0;
         PublicDataTree::AddCompletionCallback completion = [&](const auto& resp) -> void {
-            current_batch++;
-            if (current_batch == public_writes.size()) {
-                decr(resp);
+            if (!resp.success || ++current_batch == public_write_batches.size()) {
+                check_tree(MerkleTreeId::PUBLIC_DATA_TREE, resp.success, resp.message);
             } else {
-                wrapper.tree->add_or_update_values(public_writes[current_batch], 0, completion);
+                wrapper.tree->add_or_update_values(public_write_batches[current_batch], 0, completion);
             }
         };
 
-        if (public_writes.empty()) {
-            signal.signal_decrement();
+        if (public_write_batches.empty()) {
+            check_tree(MerkleTreeId::PUBLIC_DATA_TREE, true, "");
         } else {
-            wrapper.tree->add_or_update_values(public_writes[current_batch], 0, completion);
+            wrapper.tree->add_or_update_values(public_write_batches[current_batch], 0, completion);
         }
 
         // block inside this scope in order to keep current_batch/completion alive until the end of all operations
         signal.wait_for_level();
     }
+    status.syncTimings.insertionTimeUs = static_cast<uint64_t>(insertion_timer.nanoseconds() / 1000);
 
     if (!success) {
-        throw std::runtime_error("Failed to sync block: " + err_message);
+        throw std::runtime_error(err_message);
     }
 
     if (!is_archive_tip(WorldStateRevision::uncommitted(), block_header_hash)) {
         throw std::runtime_error("Can't synch block: block header hash is not the tip of the archive tree");
     }
 
-    if (!is_same_state_reference(WorldStateRevision::uncommitted(), block_state_ref)) {
-        throw std::runtime_error("Can't synch block: block state does not match world state");
-    }
-
+    // Every tree has been validated, commit them all (in parallel)
+    Timer commit_timer;
     if (!commit()) {
         throw std::runtime_error("Commit failed");
     }
+    status.syncTimings.commitTimeUs = static_cast<uint64_t>(commit_timer.nanoseconds() / 1000);
+
     get_status(status);
+    status.syncTimings.totalTimeUs = static_cast<uint64_t>(total_timer.nanoseconds() / 1000);
     return status;
 }
 
@@ -540,6 +696,43 @@ GetLowIndexedLeafResponse WorldState::find_low_leaf_index(const WorldStateRevisi
     return low_leaf_info;
 }
 
+std::vector<GetLowIndexedLeafResponse> WorldState::find_low_leaf_indices(const WorldStateRevision& revision,
+                                                                         MerkleTreeId tree_id,
+                                                                         const std::vector<bb::fr>& leaf_keys) const
+{
+    Fork::SharedPtr fork = retrieve_fork(revision.forkId);
+    Signal signal;
+    TypedResponse<GetLowIndexedLeavesResponse> response;
+    auto callback = [&signal, &response](const TypedResponse<GetLowIndexedLeavesResponse>& r) {
+        response = r;
+        signal.signal_level();
+    };
+
+    if (const auto* wrapper = std::get_if<TreeWithStore<NullifierTree>>(&fork->_trees.at(tree_id))) {
+        if (revision.blockNumber != 0U) {
+            wrapper->tree->find_low_leaves(leaf_keys, revision.blockNumber, revision.includeUncommitted, callback);
+        } else {
+            wrapper->tree->find_low_leaves(leaf_keys, revision.includeUncommitted, callback);
+        }
+
+    } else if (const auto* wrapper = std::get_if<TreeWithStore<PublicDataTree>>(&fork->_trees.at(tree_id))) {
+        if (revision.blockNumber != 0U) {
+            wrapper->tree->find_low_leaves(leaf_keys, revision.blockNumber, revision.includeUncommitted, callback);
+        } else {
+            wrapper->tree->find_low_leaves(leaf_keys, revision.includeUncommitted, callback);
+        }
+
+    } else {
+        throw std::runtime_error("Invalid tree type for find_low_leaves");
+    }
+
+    signal.wait_for_level();
+    if (!response.success) {
+        throw std::runtime_error("Failed to find low leaves: " + response.message);
+    }
+    return response.inner.low_leaves;
+}
+
 WorldStateStatus WorldState::set_finalised_blocks(const index_t& toBlockNumber)
 {
     WorldStateRevision revision{ .forkId = CANONICAL_FORK_ID, .blockNumber = 0, .includeUncommitted = false };
@@ -603,6 +796,7 @@ bool WorldState::set_finalised_block(const index_t& blockNumber)
             tree);
     }
     signal.wait_for_level();
+    clear_fork_templates();
     return success;
 }
 bool WorldState::unwind_block(const index_t& blockNumber)
@@ -621,6 +815,7 @@ bool WorldState::unwind_block(const index_t& blockNumber)
             tree);
     }
     signal.wait_for_level();
+    clear_fork_templates();
     remove_forks_for_block(blockNumber);
     return success;
 }
@@ -640,6 +835,7 @@ bool WorldState::remove_historical_block(const index_t& blockNumber)
             tree);
     }
     signal.wait_for_level();
+    clear_fork_templates();
     remove_forks_for_block(blockNumber);
     return success;
 }
@@ -100,6 +100,18 @@ class WorldState {
                                                           MerkleTreeId tree_id,
                                                           index_t leaf_index) const;
 
+    /**
+     * @brief Get the sibling paths for a number of leaves in a tree, reading them together
+     *
+     * @param revision The revision to query
+     * @param tree_id The ID of the tree
+     * @param leaf_indices The indices of the leaves
+     * @return std::vector<crypto::merkle_tree::fr_sibling_path> The paths, in the order of the indices
+     */
+    std::vector<crypto::merkle_tree::fr_sibling_path> get_sibling_paths(const WorldStateRevision& revision,
+                                                                        MerkleTreeId tree_id,
+                                                                        const std::vector<index_t>& leaf_indices) const;
+
     /**
      * @brief Get the leaf preimage object
      *
@@ -139,6 +151,17 @@ class WorldState {
                                                                        MerkleTreeId tree_id,
                                                                        const bb::fr& leaf_key) const;
 
+    /**
+     * @brief Finds the low leaves of a number of keys, as find_low_leaf_index does, reading them together
+     *
+     * @param revision The revision to query
+     * @param tree_id The ID of the tree
+     * @param leaf_keys The leaves to find the predecessors of
+     * @return The low leaves, in the order of the keys
+     */
+    std::vector<crypto::merkle_tree::GetLowIndexedLeafResponse> find_low_leaf_indices(
+        const WorldStateRevision& revision, MerkleTreeId tree_id, const std::vector<bb::fr>& leaf_keys) const;
+
     /**
      * @brief Finds the index of a leaf in a tree
      *
@@ -223,6 +246,13 @@ class WorldState {
         const std::vector<crypto::merkle_tree::NullifierLeafValue>& nullifiers,
         const std::vector<std::vector<crypto::merkle_tree::PublicDataLeafValue>>& public_writes);
 
+    /**
+     * @brief Merges consecutive batches of public writes that do not write to any common slot. Inserting the merged
+     * batches leaves the public data tree in the same state as inserting the original ones.
+     */
+    static std::vector<std::vector<crypto::merkle_tree::PublicDataLeafValue>> merge_public_write_batches(
+        const std::vector<std::vector<crypto::merkle_tree::PublicDataLeafValue>>& public_writes);
+
   private:
     std::shared_ptr<bb::ThreadPool> _workers;
     WorldStateStores::Ptr _persistentStores;
@@ -232,6 +262,10 @@ class WorldState {
     mutable std::mutex mtx;
     std::unordered_map<uint64_t, Fork::SharedPtr> _forks;
     uint64_t _forkId = 0;
+    // Pristine forks at the blocks that have been forked from, new forks at these blocks are snapshots of them. They
+    // are dropped whenever the canonical state changes, as their meta data may then be out of date.
+    std::unordered_map<index_t, Fork::SharedPtr> _fork_templates;
+    uint64_t _fork_templates_generation = 0;
     uint32_t _initial_header_generator_point;
 
     TreeStateReference get_tree_snapshot(MerkleTreeId id);
@@ -241,6 +275,9 @@ class WorldState {
 
     Fork::SharedPtr retrieve_fork(const uint64_t& forkId) const;
     Fork::SharedPtr create_new_fork(const index_t& blockNumber);
+    Fork::SharedPtr initialise_fork(const index_t& blockNumber);
+    static Fork::SharedPtr snapshot_fork(const Fork& fork);
+    void clear_fork_templates();
     void remove_forks_for_block(const index_t& blockNumber);
 
     bool unwind_block(const index_t& blockNumber);
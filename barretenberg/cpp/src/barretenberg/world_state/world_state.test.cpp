@@ -652,6 +652,76 @@ TEST_F(WorldStateTest, RejectSyncBlockWithInvalidStateRef)
     EXPECT_THROW(sync(), std::runtime_error);
 }
 
+TEST_F(WorldStateTest, RejectedBlockIsNotPartiallyCommitted)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    StateReference initial_state_ref = ws.get_state_reference(WorldStateRevision::committed());
+    StateReference block_state_ref = initial_state_ref;
+    // only the public data tree will not match
+    block_state_ref[MerkleTreeId::NOTE_HASH_TREE] = {
+        fr("0x15dad063953d8d216c1db77739d6fb27e1b73a5beef748a1208898b3428781eb"), 1
+    };
+    block_state_ref[MerkleTreeId::PUBLIC_DATA_TREE] = { fr(1), 129 };
+
+    EXPECT_THROW(ws.sync_block(block_state_ref, fr(1), { 42 }, {}, {}, { { PublicDataLeafValue(145, 1) } }),
+                 std::runtime_error);
+
+    // no tree is committed before the whole block has been validated
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision::committed()), initial_state_ref);
+    WorldStateStatus status;
+    ws.get_status(status);
+    EXPECT_EQ(status.unfinalisedBlockNumber, 0UL);
+    EXPECT_EQ(ws.find_leaf_index(WorldStateRevision::committed(), MerkleTreeId::ARCHIVE, fr(1)), std::nullopt);
+}
+
+TEST_F(WorldStateTest, MergesPublicWriteBatchesWithoutCommonSlots)
+{
+    auto merged = WorldState::merge_public_write_batches({
+        { PublicDataLeafValue(1, 1), PublicDataLeafValue(2, 1) },
+        { PublicDataLeafValue(3, 1), PublicDataLeafValue::empty() },
+        { PublicDataLeafValue::empty() },
+        { PublicDataLeafValue(1, 2) },
+        { PublicDataLeafValue(4, 1) },
+    });
+    std::vector<std::vector<PublicDataLeafValue>> expected{
+        { PublicDataLeafValue(1, 1),
+          PublicDataLeafValue(2, 1),
+          PublicDataLeafValue(3, 1),
+          PublicDataLeafValue::empty(),
+          PublicDataLeafValue::empty() },
+        { PublicDataLeafValue(1, 2), PublicDataLeafValue(4, 1) },
+    };
+    EXPECT_EQ(merged, expected);
+    EXPECT_TRUE(WorldState::merge_public_write_batches({}).empty());
+}
+
+TEST_F(WorldStateTest, SyncBlockWithManyPublicWriteBatches)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    std::vector<std::vector<PublicDataLeafValue>> public_writes{
+        { PublicDataLeafValue(129, 1), PublicDataLeafValue(130, 1) },
+        { PublicDataLeafValue(131, 1) },
+        { PublicDataLeafValue(129, 2), PublicDataLeafValue(132, 1) },
+        { PublicDataLeafValue(133, 1) },
+    };
+
+    // build the expected state by inserting the batches one at a time
+    auto fork_id = ws.create_fork(0);
+    ws.append_leaves<bb::fr>(MerkleTreeId::NOTE_HASH_TREE, { 42 }, fork_id);
+    ws.append_leaves<bb::fr>(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, { 43 }, fork_id);
+    ws.batch_insert_indexed_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, { { 129 } }, 0, fork_id);
+    for (const auto& batch : public_writes) {
+        ws.batch_insert_indexed_leaves<PublicDataLeafValue>(MerkleTreeId::PUBLIC_DATA_TREE, batch, 0, fork_id);
+    }
+    auto fork_state_ref = ws.get_state_reference(WorldStateRevision{ .forkId = fork_id, .includeUncommitted = true });
+    ws.delete_fork(fork_id);
+
+    WorldStateStatus status = ws.sync_block(fork_state_ref, { 1 }, { 42 }, { 43 }, { { 129 } }, public_writes);
+    EXPECT_EQ(status.unfinalisedBlockNumber, 1UL);
+    EXPECT_EQ(status.syncTimings.publicWriteBatches, 2UL);
+    EXPECT_EQ(fork_state_ref, ws.get_state_reference(WorldStateRevision::committed()));
+}
+
 TEST_F(WorldStateTest, SyncEmptyBlock)
 {
     WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
@@ -778,3 +848,61 @@ TEST_F(WorldStateTest, BuildsABlockInAFork)
 
     EXPECT_EQ(fork_state_ref, ws.get_state_reference(WorldStateRevision::committed()));
 }
+
+TEST_F(WorldStateTest, ForksAtTheSameBlockAreIsolated)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    auto first_fork_id = ws.create_fork(0);
+    ws.append_leaves<bb::fr>(MerkleTreeId::NOTE_HASH_TREE, { 42 }, first_fork_id);
+    ws.batch_insert_indexed_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, { { 129 } }, 0, first_fork_id);
+
+    // the second fork is created after the first was modified, it must not see those modifications
+    auto second_fork_id = ws.create_fork(0);
+    assert_fork_state_unchanged(ws, second_fork_id, true);
+    ws.append_leaves<bb::fr>(MerkleTreeId::NOTE_HASH_TREE, { 43 }, second_fork_id);
+    assert_leaf_value<bb::fr>(ws,
+                              WorldStateRevision{ .forkId = first_fork_id, .includeUncommitted = true },
+                              MerkleTreeId::NOTE_HASH_TREE,
+                              0,
+                              42);
+    assert_leaf_value<bb::fr>(ws,
+                              WorldStateRevision{ .forkId = second_fork_id, .includeUncommitted = true },
+                              MerkleTreeId::NOTE_HASH_TREE,
+                              0,
+                              43);
+
+    // forks created after the canonical state changed must see the new state
+    StateReference block_state_ref = ws.get_state_reference(WorldStateRevision::committed());
+    ws.sync_block(block_state_ref, fr(1), {}, {}, {}, {});
+    auto latest_fork_id = ws.create_fork(std::nullopt);
+    assert_fork_state_unchanged(ws, latest_fork_id, false);
+    ws.set_finalised_blocks(1);
+    auto finalised_fork_id = ws.create_fork(1);
+    assert_fork_state_unchanged(ws, finalised_fork_id, false);
+}
+
+TEST_F(WorldStateTest, GetsSiblingPathsAndLowLeavesInBatches)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, { fr(42), fr(43), fr(44) });
+    ws.batch_insert_indexed_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, { { 200 }, { 300 } }, 0);
+
+    for (auto revision : { WorldStateRevision::committed(), WorldStateRevision::uncommitted() }) {
+        std::vector<index_t> indices = { 2, 0, 1000, 2 };
+        auto paths = ws.get_sibling_paths(revision, MerkleTreeId::NOTE_HASH_TREE, indices);
+        ASSERT_EQ(paths.size(), indices.size());
+        for (size_t i = 0; i < indices.size(); ++i) {
+            EXPECT_EQ(paths[i], ws.get_sibling_path(revision, MerkleTreeId::NOTE_HASH_TREE, indices[i]));
+        }
+
+        std::vector<fr> keys = { 250, 200, 1, 400 };
+        auto low_leaves = ws.find_low_leaf_indices(revision, MerkleTreeId::NULLIFIER_TREE, keys);
+        ASSERT_EQ(low_leaves.size(), keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            EXPECT_EQ(low_leaves[i], ws.find_low_leaf_index(revision, MerkleTreeId::NULLIFIER_TREE, keys[i]));
+        }
+    }
+
+    EXPECT_THROW(ws.find_low_leaf_indices(WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, { 1 }),
+                 std::runtime_error);
+}
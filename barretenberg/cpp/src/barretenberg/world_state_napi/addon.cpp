@@ -33,6 +33,7 @@ const uint64_t DEFAULT_MAP_SIZE = 1024 * 1024;
 
 WorldStateAddon::WorldStateAddon(const Napi::CallbackInfo& info)
     : ObjectWrap(info)
+    , _response_buffers(std::make_shared<BufferPool>())
 {
     uint64_t thread_pool_size = 16;
     std::string data_dir;
@@ -150,6 +151,10 @@ WorldStateAddon::WorldStateAddon(const Napi::CallbackInfo& info)
         WorldStateMessageType::GET_SIBLING_PATH,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_sibling_path(obj, buffer); });
 
+    _dispatcher.registerTarget(
+        WorldStateMessageType::GET_SIBLING_PATHS,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_sibling_paths(obj, buffer); });
+
     _dispatcher.registerTarget(
         WorldStateMessageType::FIND_LEAF_INDEX,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return find_leaf_index(obj, buffer); });
@@ -158,6 +163,10 @@ WorldStateAddon::WorldStateAddon(const Napi::CallbackInfo& info)
         WorldStateMessageType::FIND_LOW_LEAF,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return find_low_leaf(obj, buffer); });
 
+    _dispatcher.registerTarget(
+        WorldStateMessageType::FIND_LOW_LEAVES,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return find_low_leaves(obj, buffer); });
+
     _dispatcher.registerTarget(
         WorldStateMessageType::APPEND_LEAVES,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return append_leaves(obj, buffer); });
@@ -208,7 +217,25 @@ WorldStateAddon::WorldStateAddon(const Napi::CallbackInfo& info)
                                [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return close(obj, buffer); });
 }
 
+namespace {
+// Have msgpack reference strings and binary data in the input buffer instead of copying them into its zone
+bool reference_input(msgpack::type::object_type /*unused*/, size_t /*unused*/, void* /*unused*/)
+{
+    return true;
+}
+} // namespace
+
 Napi::Value WorldStateAddon::call(const Napi::CallbackInfo& info)
+{
+    return queue_call(info, false);
+}
+
+Napi::Value WorldStateAddon::call_batch(const Napi::CallbackInfo& info)
+{
+    return queue_call(info, true);
+}
+
+Napi::Value WorldStateAddon::queue_call(const Napi::CallbackInfo& info, bool batch)
 {
     Napi::Env env = info.Env();
     // keep this in a shared pointer so that AsyncOperation can resolve/reject the promise once the execution is
@@ -223,18 +250,38 @@ Napi::Value WorldStateAddon::call(const Napi::CallbackInfo& info)
         deferred->Reject(Napi::TypeError::New(env, "World state has been closed").Value());
     } else {
         auto buffer = info[0].As<Napi::Buffer<char>>();
+        // we mustn't access the Napi::Env outside of this top-level function, but the AsyncOperation holds a reference
+        // to the buffer until it completes, so its memory can be read in place from the worker thread
+        const char* data = buffer.Data();
         size_t length = buffer.Length();
-        // we mustn't access the Napi::Env outside of this top-level function
-        // so copy the data to a variable we own
-        // and make it a shared pointer so that it doesn't get destroyed as soon as we exit this code block
-        auto data = std::make_shared<std::vector<char>>(length);
-        std::copy_n(buffer.Data(), length, data->data());
-
-        auto* op = new AsyncOperation(env, deferred, [=, this](msgpack::sbuffer& buf) {
-            msgpack::object_handle obj_handle = msgpack::unpack(data->data(), length);
-            msgpack::object obj = obj_handle.get();
-            _dispatcher.onNewData(obj, buf);
-        });
+
+        auto* op = new AsyncOperation(
+            env,
+            deferred,
+            [=, this](msgpack::sbuffer& buf) {
+                size_t offset = 0;
+                if (!batch) {
+                    msgpack::object_handle obj_handle = msgpack::unpack(data, length, offset, reference_input);
+                    msgpack::object obj = obj_handle.get();
+                    _dispatcher.onNewData(obj, buf);
+                    return;
+                }
+                for (size_t index = 0; offset < length; ++index) {
+                    // a message earlier in the batch may have closed the world state
+                    if (!_ws) {
+                        throw std::runtime_error("World state has been closed");
+                    }
+                    msgpack::object_handle obj_handle = msgpack::unpack(data, length, offset, reference_input);
+                    msgpack::object obj = obj_handle.get();
+                    try {
+                        _dispatcher.onNewData(obj, buf);
+                    } catch (const std::exception& e) {
+                        throw std::runtime_error("Message " + std::to_string(index) + " of batch failed: " + e.what());
+                    }
+                }
+            },
+            _response_buffers,
+            buffer);
 
         // Napi is now responsible for destroying this object
         op->Queue();
@@ -383,6 +430,23 @@ bool WorldStateAddon::get_sibling_path(msgpack::object& obj, msgpack::sbuffer& b
     return true;
 }
 
+bool WorldStateAddon::get_sibling_paths(msgpack::object& obj, msgpack::sbuffer& buffer) const
+{
+    TypedMessage<GetSiblingPathsRequest> request;
+    obj.convert(request);
+
+    std::vector<fr_sibling_path> paths =
+        _ws->get_sibling_paths(request.value.revision, request.value.treeId, request.value.leafIndices);
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<std::vector<fr_sibling_path>> resp_msg(
+        WorldStateMessageType::GET_SIBLING_PATHS, header, paths);
+
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
 bool WorldStateAddon::find_leaf_index(msgpack::object& obj, msgpack::sbuffer& buffer) const
 {
     TypedMessage<TreeIdAndRevisionRequest> request;
@@ -436,6 +500,28 @@ bool WorldStateAddon::find_low_leaf(msgpack::object& obj, msgpack::sbuffer& buff
     return true;
 }
 
+bool WorldStateAddon::find_low_leaves(msgpack::object& obj, msgpack::sbuffer& buffer) const
+{
+    TypedMessage<FindLowLeavesRequest> request;
+    obj.convert(request);
+
+    std::vector<GetLowIndexedLeafResponse> low_leaves =
+        _ws->find_low_leaf_indices(request.value.revision, request.value.treeId, request.value.keys);
+
+    std::vector<FindLowLeafResponse> low_leaf_infos;
+    low_leaf_infos.reserve(low_leaves.size());
+    for (const auto& low_leaf_info : low_leaves) {
+        low_leaf_infos.push_back({ low_leaf_info.is_already_present, low_leaf_info.index });
+    }
+
+    MsgHeader header(request.header.messageId);
+    TypedMessage<std::vector<FindLowLeafResponse>> response(
+        WorldStateMessageType::FIND_LOW_LEAVES, header, low_leaf_infos);
+    msgpack::pack(buffer, response);
+
+    return true;
+}
+
 bool WorldStateAddon::append_leaves(msgpack::object& obj, msgpack::sbuffer& buf)
 {
     TypedMessage<TreeIdOnlyRequest> request;
@@ -676,6 +762,7 @@ Napi::Function WorldStateAddon::get_class(Napi::Env env)
                        "WorldState",
                        {
                            WorldStateAddon::InstanceMethod("call", &WorldStateAddon::call),
+                           WorldStateAddon::InstanceMethod("callBatch", &WorldStateAddon::call_batch),
                        });
 }
 
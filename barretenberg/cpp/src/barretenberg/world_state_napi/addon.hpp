@@ -3,6 +3,7 @@
 #include "barretenberg/messaging/dispatcher.hpp"
 #include "barretenberg/world_state/types.hpp"
 #include "barretenberg/world_state/world_state.hpp"
+#include "barretenberg/world_state_napi/buffer_pool.hpp"
 #include "barretenberg/world_state_napi/message.hpp"
 #include <cstdint>
 #include <memory>
@@ -18,10 +19,17 @@ class WorldStateAddon : public Napi::ObjectWrap<WorldStateAddon> {
     WorldStateAddon(const Napi::CallbackInfo&);
 
     /**
-     * @brief The only instance method exposed to JavaScript. Takes a msgpack Message and returns a Promise
+     * @brief Takes a msgpack Message and returns a Promise of the msgpack response
      */
     Napi::Value call(const Napi::CallbackInfo&);
 
+    /**
+     * @brief Takes a buffer of msgpack Messages written back to back and returns a Promise of their responses, also
+     * back to back. The messages are handled in order and the first failure rejects the whole batch, leaving the
+     * effects of the messages before it in place
+     */
+    Napi::Value call_batch(const Napi::CallbackInfo&);
+
     /**
      * @brief Register the WorldStateAddon class with the JavaScript runtime.
      */
@@ -30,6 +38,9 @@ class WorldStateAddon : public Napi::ObjectWrap<WorldStateAddon> {
   private:
     std::unique_ptr<bb::world_state::WorldState> _ws;
     bb::messaging::MessageDispatcher _dispatcher;
+    std::shared_ptr<BufferPool> _response_buffers;
+
+    Napi::Value queue_call(const Napi::CallbackInfo& info, bool batch);
 
     bool get_tree_info(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_state_reference(msgpack::object& obj, msgpack::sbuffer& buffer) const;
@@ -38,9 +49,11 @@ class WorldStateAddon : public Napi::ObjectWrap<WorldStateAddon> {
     bool get_leaf_value(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_leaf_preimage(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_sibling_path(msgpack::object& obj, msgpack::sbuffer& buffer) const;
+    bool get_sibling_paths(msgpack::object& obj, msgpack::sbuffer& buffer) const;
 
     bool find_leaf_index(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool find_low_leaf(msgpack::object& obj, msgpack::sbuffer& buffer) const;
+    bool find_low_leaves(msgpack::object& obj, msgpack::sbuffer& buffer) const;
 
     bool append_leaves(msgpack::object& obj, msgpack::sbuffer& buffer);
     bool batch_insert(msgpack::object& obj, msgpack::sbuffer& buffer);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "barretenberg/serialize/cbind.hpp"
+#include "barretenberg/world_state_napi/buffer_pool.hpp"
 #include <memory>
 #include <napi.h>
 #include <utility>
@@ -14,8 +15,9 @@ using async_fn = std::function<void(msgpack::sbuffer&)>;
  *
  * This class takes a Deferred instance (i.e. a Promise to JS), execute some work in a separate thread, and then report
  * back on the result. The async execution _must not_ touch the JS environment. Everything that's needed to complete the
- * work must be copied into memory owned by the C++ code. The same has to be done when reporting back the result: keep
- * the result in memory owned by the C++ code and copy it back to the JS environment in the OnOK/OnError methods.
+ * work must either be copied into memory owned by the C++ code or, like the input buffer, be kept alive by a reference
+ * taken on the main thread. The result is serialised into a buffer from the pool, which is handed to JS without a copy
+ * in OnOK.
  *
  * OnOK/OnError will be called on the main JS thread, so it's safe to interact with the JS environment there.
  *
@@ -26,10 +28,20 @@ using async_fn = std::function<void(msgpack::sbuffer&)>;
  */
 class AsyncOperation : public Napi::AsyncWorker {
   public:
-    AsyncOperation(Napi::Env env, std::shared_ptr<Napi::Promise::Deferred> deferred, async_fn fn)
+    /**
+     * @param input The JS buffer the work reads from. It is referenced until the operation completes, so the work can
+     * read it in place; JS must not modify it in the meantime
+     */
+    AsyncOperation(Napi::Env env,
+                   std::shared_ptr<Napi::Promise::Deferred> deferred,
+                   async_fn fn,
+                   std::shared_ptr<BufferPool> pool,
+                   const Napi::Buffer<char>& input)
         : Napi::AsyncWorker(env)
         , _fn(std::move(fn))
         , _deferred(std::move(deferred))
+        , _pool(std::move(pool))
+        , _input(Napi::Persistent(input))
     {}
 
     AsyncOperation(const AsyncOperation&) = delete;
@@ -42,23 +54,29 @@ class AsyncOperation : public Napi::AsyncWorker {
     void Execute() override
     {
         try {
-            _fn(_result);
+            _result = _pool->acquire();
+            _fn(*_result);
         } catch (const std::exception& e) {
             SetError(e.what());
         }
     }
 
-    void OnOK() override
+    void OnOK() override { _deferred->Resolve(_pool->to_js_buffer(Env(), std::move(_result))); }
+    void OnError(const Napi::Error& e) override
     {
-        auto buf = Napi::Buffer<char>::Copy(Env(), _result.data(), _result.size());
-        _deferred->Resolve(buf);
+        if (_result) {
+            _pool->release(std::move(_result));
+        }
+        _deferred->Reject(e.Value());
     }
-    void OnError(const Napi::Error& e) override { _deferred->Reject(e.Value()); }
 
   private:
     async_fn _fn;
     std::shared_ptr<Napi::Promise::Deferred> _deferred;
-    msgpack::sbuffer _result;
+    std::shared_ptr<BufferPool> _pool;
+    // released in the destructor, which runs on the main thread after OnOK/OnError
+    Napi::Reference<Napi::Buffer<char>> _input;
+    std::unique_ptr<msgpack::sbuffer> _result;
 };
 
 } // namespace bb::world_state
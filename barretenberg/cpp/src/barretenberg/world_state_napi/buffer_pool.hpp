@@ -0,0 +1,92 @@
+#pragma once
+
+#include "barretenberg/serialize/cbind.hpp"
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <napi.h>
+#include <utility>
+#include <vector>
+
+namespace bb::world_state {
+
+/**
+ * @brief A pool of the buffers that responses are serialised into
+ *
+ * @details A response buffer is handed to JS as an external buffer, without copying it. Once JS has garbage collected
+ * it, its finalizer returns the buffer to the pool, where it keeps its allocation for the next response. Buffers are
+ * acquired on worker threads and released on the main JS thread, hence the mutex.
+ *
+ * The finalizers hold a shared pointer to the pool, so that it outlives the addon if responses are still alive in JS.
+ */
+class BufferPool : public std::enable_shared_from_this<BufferPool> {
+  public:
+    static constexpr size_t DEFAULT_MAX_POOLED_BUFFERS = 16;
+    // Buffers that grew beyond this are freed rather than pooled, so that one large response does not pin its memory
+    static constexpr size_t DEFAULT_MAX_POOLED_SIZE = 64UL * 1024 * 1024;
+
+    BufferPool(size_t max_pooled_buffers = DEFAULT_MAX_POOLED_BUFFERS,
+               size_t max_pooled_size = DEFAULT_MAX_POOLED_SIZE)
+        : _max_pooled_buffers(max_pooled_buffers)
+        , _max_pooled_size(max_pooled_size)
+    {}
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+    BufferPool(BufferPool&&) = delete;
+    BufferPool& operator=(BufferPool&&) = delete;
+    ~BufferPool() = default;
+
+    std::unique_ptr<msgpack::sbuffer> acquire()
+    {
+        std::unique_lock lock(_mtx);
+        if (_buffers.empty()) {
+            return std::make_unique<msgpack::sbuffer>();
+        }
+        std::unique_ptr<msgpack::sbuffer> buffer = std::move(_buffers.back());
+        _buffers.pop_back();
+        return buffer;
+    }
+
+    void release(std::unique_ptr<msgpack::sbuffer> buffer)
+    {
+        // sbuffer does not expose its capacity, its size is a lower bound for it
+        if (buffer->size() > _max_pooled_size) {
+            return;
+        }
+        buffer->clear();
+        std::unique_lock lock(_mtx);
+        if (_buffers.size() < _max_pooled_buffers) {
+            _buffers.push_back(std::move(buffer));
+        }
+    }
+
+    /**
+     * @brief Wraps the buffer in a JS Buffer without copying it. Must be called on the main JS thread.
+     */
+    Napi::Buffer<char> to_js_buffer(Napi::Env env, std::unique_ptr<msgpack::sbuffer> buffer)
+    {
+        auto* hint = new PooledBuffer{ shared_from_this(), std::move(buffer) };
+        // NewOrCopy falls back to a copy, finalizing straight away, in runtimes that forbid external buffers
+        return Napi::Buffer<char>::NewOrCopy(env, hint->buffer->data(), hint->buffer->size(), finalize, hint);
+    }
+
+  private:
+    struct PooledBuffer {
+        std::shared_ptr<BufferPool> pool;
+        std::unique_ptr<msgpack::sbuffer> buffer;
+    };
+
+    static void finalize(Napi::Env /*unused*/, char* /*unused*/, PooledBuffer* hint)
+    {
+        std::unique_ptr<PooledBuffer> owned(hint);
+        owned->pool->release(std::move(owned->buffer));
+    }
+
+    size_t _max_pooled_buffers;
+    size_t _max_pooled_size;
+    std::mutex _mtx;
+    std::vector<std::unique_ptr<msgpack::sbuffer>> _buffers;
+};
+
+} // namespace bb::world_state
@@ -43,6 +43,9 @@ enum WorldStateMessageType {
 
     GET_STATUS,
 
+    GET_SIBLING_PATHS,
+    FIND_LOW_LEAVES,
+
     CLOSE = 999,
 };
 
@@ -128,6 +131,13 @@ struct GetSiblingPathRequest {
     MSGPACK_FIELDS(treeId, revision, leafIndex);
 };
 
+struct GetSiblingPathsRequest {
+    MerkleTreeId treeId;
+    WorldStateRevision revision;
+    std::vector<index_t> leafIndices;
+    MSGPACK_FIELDS(treeId, revision, leafIndices);
+};
+
 template <typename T> struct FindLeafIndexRequest {
     MerkleTreeId treeId;
     WorldStateRevision revision;
@@ -148,6 +158,13 @@ struct FindLowLeafResponse {
     MSGPACK_FIELDS(alreadyPresent, index);
 };
 
+struct FindLowLeavesRequest {
+    MerkleTreeId treeId;
+    WorldStateRevision revision;
+    std::vector<fr> keys;
+    MSGPACK_FIELDS(treeId, revision, keys);
+};
+
 struct BlockShiftRequest {
     index_t toBlockNumber;
     MSGPACK_FIELDS(toBlockNumber);
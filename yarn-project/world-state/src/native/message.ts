@@ -77,6 +77,9 @@ export enum WorldStateMessageType {
 
   GET_STATUS,
 
+  GET_SIBLING_PATHS,
+  FIND_LOW_LEAVES,
+
   CLOSE = 999,
 }
 
@@ -91,6 +94,21 @@ export interface WorldStateStatus {
   finalisedBlockNumber: bigint;
   /** Oldest block still available for historical queries and forks. */
   oldestHistoricalBlock: bigint;
+  /** Time spent in each stage of the last block sync. Only populated when syncing a block. */
+  syncTimings?: WorldStateSyncTimings;
+}
+
+export interface WorldStateSyncTimings {
+  /** Time spent rolling back uncommitted state, in microseconds. */
+  rollbackTimeUs: bigint;
+  /** Time until the block was inserted into and checked against all trees, in microseconds. */
+  insertionTimeUs: bigint;
+  /** Time spent committing all trees once the block was validated, in microseconds. */
+  commitTimeUs: bigint;
+  /** Total time spent syncing the block, in microseconds. */
+  totalTimeUs: bigint;
+  /** Number of insertions the public writes were applied in. */
+  publicWriteBatches: bigint;
 }
 
 interface WithForkId {
@@ -139,6 +157,11 @@ interface GetTreeInfoResponse {
 interface GetSiblingPathRequest extends WithTreeId, WithLeafIndex, WithWorldStateRevision {}
 type GetSiblingPathResponse = Buffer[];
 
+interface GetSiblingPathsRequest extends WithTreeId, WithWorldStateRevision {
+  leafIndices: bigint[];
+}
+type GetSiblingPathsResponse = Buffer[][];
+
 interface GetStateReferenceRequest extends WithWorldStateRevision {}
 interface GetStateReferenceResponse {
   state: Record<MerkleTreeId, TreeStateReference>;
@@ -163,6 +186,11 @@ interface FindLowLeafResponse {
   alreadyPresent: boolean;
 }
 
+interface FindLowLeavesRequest extends WithTreeId, WithWorldStateRevision {
+  keys: Fr[];
+}
+type FindLowLeavesResponse = FindLowLeafResponse[];
+
 interface AppendLeavesRequest extends WithTreeId, WithForkId, WithLeaves {}
 
 interface BatchInsertRequest extends WithTreeId, WithForkId, WithLeaves {
@@ -249,6 +277,9 @@ export type WorldStateRequest = {
 
   [WorldStateMessageType.GET_STATUS]: void;
 
+  [WorldStateMessageType.GET_SIBLING_PATHS]: GetSiblingPathsRequest;
+  [WorldStateMessageType.FIND_LOW_LEAVES]: FindLowLeavesRequest;
+
   [WorldStateMessageType.CLOSE]: void;
 };
 
@@ -283,6 +314,9 @@ export type WorldStateResponse = {
 
   [WorldStateMessageType.GET_STATUS]: WorldStateStatus;
 
+  [WorldStateMessageType.GET_SIBLING_PATHS]: GetSiblingPathsResponse;
+  [WorldStateMessageType.FIND_LOW_LEAVES]: FindLowLeavesResponse;
+
   [WorldStateMessageType.CLOSE]: void;
 };
 
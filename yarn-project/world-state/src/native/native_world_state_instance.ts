@@ -39,7 +39,15 @@ addExtension({
 });
 
 export interface NativeInstance {
+  /**
+   * Sends one msgpack message. The buffer is read in place and must not be modified until the promise settles.
+   */
   call(msg: Buffer | Uint8Array): Promise<any>;
+  /**
+   * Sends several msgpack messages written back to back and resolves to their responses, also back to back.
+   * The messages are handled in order and the first failure rejects the batch.
+   */
+  callBatch(msgs: Buffer | Uint8Array): Promise<any>;
 }
 
 const NATIVE_LIBRARY_NAME = 'world_state_napi';